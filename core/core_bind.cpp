@@ -38,6 +38,7 @@
 #include "core/io/marshalls.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/geometry_3d.h"
+#include "core/object/leak_profiler.h"
 #include "core/os/keyboard.h"
 
 namespace core_bind {
@@ -483,6 +484,14 @@ void OS::print_resources_in_use(bool p_short) {
 	::OS::get_singleton()->print_resources_in_use(p_short);
 }
 
+Error OS::dump_object_report_to_file(const String &p_file) {
+#ifdef DEBUG_ENABLED
+	return LeakProfiler::save_report(p_file);
+#else
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Object reports are only available in debug builds.");
+#endif
+}
+
 void OS::dump_resources_to_file(const String &p_file) {
 	::OS::get_singleton()->dump_resources_to_file(p_file.utf8().get_data());
 }
@@ -599,6 +608,7 @@ void OS::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_debug_build"), &OS::is_debug_build);
 
 	ClassDB::bind_method(D_METHOD("dump_memory_to_file", "file"), &OS::dump_memory_to_file);
+	ClassDB::bind_method(D_METHOD("dump_object_report_to_file", "file"), &OS::dump_object_report_to_file);
 	ClassDB::bind_method(D_METHOD("dump_resources_to_file", "file"), &OS::dump_resources_to_file);
 	ClassDB::bind_method(D_METHOD("print_resources_in_use", "short"), &OS::print_resources_in_use, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("print_all_resources", "tofile"), &OS::print_all_resources, DEFVAL(""));
@@ -189,6 +189,7 @@ public:
 	String get_model_name() const;
 
 	void dump_memory_to_file(const String &p_file);
+	Error dump_object_report_to_file(const String &p_file);
 	void dump_resources_to_file(const String &p_file);
 
 	void print_resources_in_use(bool p_short = false);
@@ -254,6 +254,49 @@ Vector<Vector<Point2>> Geometry2D::_polypaths_do_operation(PolyBooleanOperation
 	return polypaths;
 }
 
+Vector<Vector<Point2>> Geometry2D::merge_many_polygons(const Vector<Vector<Point2>> &p_polygons) {
+	using namespace ClipperLib;
+
+	Clipper clp;
+	for (int i = 0; i < p_polygons.size(); i++) {
+		const Vector<Point2> &polygon = p_polygons[i];
+		if (polygon.size() < 3) {
+			continue;
+		}
+
+		// Need to scale points (Clipper's requirement for robust computation).
+		Path path;
+		path.reserve(polygon.size());
+		for (int j = 0; j < polygon.size(); j++) {
+			path << IntPoint(polygon[j].x * (real_t)SCALE_FACTOR, polygon[j].y * (real_t)SCALE_FACTOR);
+		}
+		// Give all polygons the same winding, so overlapping ones add up instead of cancelling out with the non-zero fill rule.
+		if (!ClipperLib::Orientation(path)) {
+			ReversePath(path);
+		}
+		clp.AddPath(path, ptSubject, true);
+	}
+
+	Paths paths;
+	clp.Execute(ctUnion, paths, pftNonZero, pftNonZero);
+
+	// Have to scale points down now.
+	Vector<Vector<Point2>> polypaths;
+	for (Paths::size_type i = 0; i < paths.size(); ++i) {
+		Vector<Vector2> polypath;
+
+		const Path &scaled_path = paths[i];
+
+		for (Paths::size_type j = 0; j < scaled_path.size(); ++j) {
+			polypath.push_back(Point2(
+					static_cast<real_t>(scaled_path[j].X) / (real_t)SCALE_FACTOR,
+					static_cast<real_t>(scaled_path[j].Y) / (real_t)SCALE_FACTOR));
+		}
+		polypaths.push_back(polypath);
+	}
+	return polypaths;
+}
+
 Vector<Vector<Point2>> Geometry2D::_polypath_offset(const Vector<Point2> &p_polypath, real_t p_delta, PolyJoinType p_join_type, PolyEndType p_end_type) {
 	using namespace ClipperLib;
 
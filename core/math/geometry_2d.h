@@ -272,6 +272,9 @@ public:
 		return _polypaths_do_operation(OPERATION_UNION, p_polygon_a, p_polygon_b);
 	}
 
+	// Union of any number of polygons in a single pass, returns outlines (counter-clockwise) and holes (clockwise).
+	static Vector<Vector<Point2>> merge_many_polygons(const Vector<Vector<Point2>> &p_polygons);
+
 	static Vector<Vector<Point2>> clip_polygons(const Vector<Point2> &p_polygon_a, const Vector<Point2> &p_polygon_b) {
 		return _polypaths_do_operation(OPERATION_DIFFERENCE, p_polygon_a, p_polygon_b);
 	}
@@ -369,8 +369,12 @@ Error MultiplayerAPI::encode_and_compress_variants(const Variant **p_variants, i
 }
 
 Error MultiplayerAPI::decode_and_decompress_variants(Vector<Variant> &r_variants, const uint8_t *p_buffer, int p_len, int &r_len, bool p_raw, bool p_allow_object_decoding) {
+	return decode_and_decompress_variants(r_variants.ptrw(), r_variants.size(), p_buffer, p_len, r_len, p_raw, p_allow_object_decoding);
+}
+
+Error MultiplayerAPI::decode_and_decompress_variants(Variant *r_variants, int p_count, const uint8_t *p_buffer, int p_len, int &r_len, bool p_raw, bool p_allow_object_decoding) {
 	r_len = 0;
-	int argc = r_variants.size();
+	int argc = p_count;
 	if (argc == 0 && p_raw) {
 		return OK;
 	}
@@ -380,19 +384,15 @@ Error MultiplayerAPI::decode_and_decompress_variants(Vector<Variant> &r_variants
 		PackedByteArray pba;
 		pba.resize(p_len);
 		memcpy(pba.ptrw(), p_buffer, p_len);
-		r_variants.write[0] = pba;
+		r_variants[0] = pba;
 		return OK;
 	}
 
-	Vector<Variant> args;
-	Vector<const Variant *> argp;
-	args.resize(argc);
-
 	for (int i = 0; i < argc; i++) {
 		ERR_FAIL_COND_V_MSG(r_len >= p_len, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
 
 		int vlen;
-		Error err = MultiplayerAPI::decode_and_decompress_variant(r_variants.write[i], &p_buffer[r_len], p_len - r_len, &vlen, p_allow_object_decoding);
+		Error err = MultiplayerAPI::decode_and_decompress_variant(r_variants[i], &p_buffer[r_len], p_len - r_len, &vlen, p_allow_object_decoding);
 		ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid packet received. Unable to decode state variable.");
 		r_len += vlen;
 	}
@@ -77,6 +77,26 @@ public:
 	virtual uint32_t hash() const;
 };
 
+// Typed calls, each argument points to a value of the parameter type without const or reference.
+
+template <class T, class... P, size_t... Is>
+void call_with_typed_args_helper(T *p_instance, void (T::*p_method)(P...), const void **p_args, IndexSequence<Is...>) {
+	(p_instance->*p_method)(*const_cast<typename GetSimpleTypeT<P>::type_t *>(reinterpret_cast<const typename GetSimpleTypeT<P>::type_t *>(p_args[Is]))...);
+	(void)(p_args); //avoid warning
+}
+
+template <class T, class R, class... P, size_t... Is>
+void call_with_typed_args_ret_helper(T *p_instance, R (T::*p_method)(P...), const void **p_args, IndexSequence<Is...>) {
+	(p_instance->*p_method)(*const_cast<typename GetSimpleTypeT<P>::type_t *>(reinterpret_cast<const typename GetSimpleTypeT<P>::type_t *>(p_args[Is]))...);
+	(void)(p_args); //avoid warning
+}
+
+template <class T, class R, class... P, size_t... Is>
+void call_with_typed_args_retc_helper(T *p_instance, R (T::*p_method)(P...) const, const void **p_args, IndexSequence<Is...>) {
+	(p_instance->*p_method)(*const_cast<typename GetSimpleTypeT<P>::type_t *>(reinterpret_cast<const typename GetSimpleTypeT<P>::type_t *>(p_args[Is]))...);
+	(void)(p_args); //avoid warning
+}
+
 template <class T, class... P>
 class CallableCustomMethodPointer : public CallableCustomMethodPointerBase {
 	struct Data {
@@ -104,6 +124,17 @@ public:
 		call_with_variant_args(data.instance, data.method, p_arguments, p_argcount, r_call_error);
 	}
 
+	virtual const void *get_ptrcall_signature() const {
+		return CallablePtrcallSignature<typename GetSimpleTypeT<P>::type_t...>::get();
+	}
+
+	virtual void ptrcall(const void **p_arguments) const {
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(ObjectDB::get_instance(ObjectID(data.object_id)) == nullptr, "Invalid Object id '" + uitos(data.object_id) + "', can't call method.");
+#endif
+		call_with_typed_args_helper(data.instance, data.method, p_arguments, BuildIndexSequence<sizeof...(P)>{});
+	}
+
 	CallableCustomMethodPointer(T *p_instance, void (T::*p_method)(P...)) {
 		memset(&data, 0, sizeof(Data)); // Clear beforehand, may have padding bytes.
 		data.instance = p_instance;
@@ -159,6 +190,17 @@ public:
 		call_with_variant_args_ret(data.instance, data.method, p_arguments, p_argcount, r_return_value, r_call_error);
 	}
 
+	virtual const void *get_ptrcall_signature() const {
+		return CallablePtrcallSignature<typename GetSimpleTypeT<P>::type_t...>::get();
+	}
+
+	virtual void ptrcall(const void **p_arguments) const {
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(ObjectDB::get_instance(ObjectID(data.object_id)) == nullptr, "Invalid Object id '" + uitos(data.object_id) + "', can't call method.");
+#endif
+		call_with_typed_args_ret_helper(data.instance, data.method, p_arguments, BuildIndexSequence<sizeof...(P)>{});
+	}
+
 	CallableCustomMethodPointerRet(T *p_instance, R (T::*p_method)(P...)) {
 		memset(&data, 0, sizeof(Data)); // Clear beforehand, may have padding bytes.
 		data.instance = p_instance;
@@ -214,6 +256,17 @@ public:
 		call_with_variant_args_retc(data.instance, data.method, p_arguments, p_argcount, r_return_value, r_call_error);
 	}
 
+	virtual const void *get_ptrcall_signature() const {
+		return CallablePtrcallSignature<typename GetSimpleTypeT<P>::type_t...>::get();
+	}
+
+	virtual void ptrcall(const void **p_arguments) const {
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(ObjectDB::get_instance(ObjectID(data.object_id)) == nullptr, "Invalid Object id '" + uitos(data.object_id) + "', can't call method.");
+#endif
+		call_with_typed_args_retc_helper(data.instance, data.method, p_arguments, BuildIndexSequence<sizeof...(P)>{});
+	}
+
 	CallableCustomMethodPointerRetC(T *p_instance, R (T::*p_method)(P...) const) {
 		memset(&data, 0, sizeof(Data)); // Clear beforehand, may have padding bytes.
 		data.instance = p_instance;
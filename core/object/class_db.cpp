@@ -521,21 +521,199 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 	return false;
 }
 
+MethodBind *ClassDB::_get_method(const ClassInfo *p_type, const StringName &p_name) {
+	while (p_type) {
+		MethodBind *const *method = p_type->method_map.getptr(p_name);
+		if (method && *method) {
+			return *method;
+		}
+		p_type = p_type->inherits_ptr;
+	}
+	return nullptr;
+}
+
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
-	OBJTYPE_RLOCK;
+	LookupCache::Member member;
+	return _get_member(p_class, p_name, member) ? member.method : nullptr;
+}
 
-	ClassInfo *type = classes.getptr(p_class);
+void ClassDB::_add_lookup_member(LookupCache *p_cache, const ClassInfo *p_type, const StringName &p_name) {
+	LookupCache::Member *member = p_cache->members.getptr(p_name);
+	if (!member) {
+		member = &p_cache->members.insert(p_name, LookupCache::Member())->value;
+	}
 
-	while (type) {
-		MethodBind **method = type->method_map.getptr(p_name);
-		if (method && *method) {
-			return *method;
+	// Classes are added from the most derived one, so members found first take precedence.
+	if (!member->setget) {
+		member->setget = p_type->property_setget.getptr(p_name);
+	}
+	if (!member->method) {
+		MethodBind *const *method = p_type->method_map.getptr(p_name);
+		if (method) {
+			member->method = *method;
+		}
+	}
+	if (member->get_type == LookupCache::GET_NONE) {
+		const int *constant = p_type->constant_map.getptr(p_name);
+		if (p_type->property_setget.has(p_name)) {
+			member->get_type = LookupCache::GET_PROPERTY;
+		} else if (constant) {
+			member->get_type = LookupCache::GET_CONSTANT;
+			member->constant = *constant;
+		} else if (p_type->method_map.has(p_name)) {
+			member->get_type = LookupCache::GET_METHOD;
+		} else if (p_type->signal_map.has(p_name)) {
+			member->get_type = LookupCache::GET_SIGNAL;
+		}
+	}
+}
+
+// Hazard slot owned by a thread, given back when the thread exits.
+struct ClassDB::LookupHazardRef {
+	LookupHazard *hazard = nullptr;
+
+	~LookupHazardRef() {
+		if (hazard) {
+			hazard->cache.store(nullptr);
+			hazard->used.store(false, std::memory_order_release);
+		}
+	}
+};
+
+thread_local ClassDB::LookupHazardRef ClassDB::lookup_hazard_ref;
+ClassDB::LookupHazard ClassDB::lookup_hazards[LOOKUP_HAZARD_SLOTS];
+
+ClassDB::LookupHazard *ClassDB::_get_lookup_hazard() {
+	LookupHazardRef &ref = lookup_hazard_ref;
+	if (likely(ref.hazard)) {
+		return ref.hazard;
+	}
+
+	for (uint32_t i = 0; i < LOOKUP_HAZARD_SLOTS; i++) {
+		bool used = false;
+		if (lookup_hazards[i].used.compare_exchange_strong(used, true, std::memory_order_acquire)) {
+			ref.hazard = &lookup_hazards[i];
+			return ref.hazard;
 		}
-		type = type->inherits_ptr;
 	}
 	return nullptr;
 }
 
+ClassDB::LookupCache *ClassDB::_get_lookup_cache(ClassInfo *p_type) {
+	// Must be called with the class lock held for reading, so members aren't bound while building.
+	LookupCache *cache = p_type->lookup_cache.ptr.load(std::memory_order_acquire);
+	if (cache) {
+		return cache;
+	}
+
+	// Several readers may get here at once, only one of them builds the cache.
+	MutexLock mutex_lock(lookup_cache_mutex);
+
+	cache = p_type->lookup_cache.ptr.load(std::memory_order_relaxed);
+	if (!cache) {
+		cache = memnew(LookupCache);
+		for (const ClassInfo *check = p_type; check; check = check->inherits_ptr) {
+			for (const KeyValue<StringName, PropertySetGet> &E : check->property_setget) {
+				_add_lookup_member(cache, check, E.key);
+			}
+			for (const KeyValue<StringName, int> &E : check->constant_map) {
+				_add_lookup_member(cache, check, E.key);
+			}
+			for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+				_add_lookup_member(cache, check, E.key);
+			}
+			for (const KeyValue<StringName, MethodInfo> &E : check->signal_map) {
+				_add_lookup_member(cache, check, E.key);
+			}
+		}
+		lookup_caches.push_back(cache);
+
+		// Make sure the cache is fully built before other threads can see it.
+		p_type->lookup_cache.ptr.store(cache, std::memory_order_release);
+	}
+
+	return cache;
+}
+
+bool ClassDB::_get_member(const StringName &p_class, const StringName &p_name, LookupCache::Member &r_member) {
+	// Like has_method(), relies on classes not being registered while their members are looked up.
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return false;
+	}
+
+	LookupHazard *hazard = _get_lookup_hazard();
+	if (unlikely(!hazard)) {
+		// More threads than hazard slots, hold the lock instead so the cache can't be freed.
+		OBJTYPE_RLOCK;
+		const LookupCache::Member *member = _get_lookup_cache(type)->members.getptr(p_name);
+		if (member) {
+			r_member = *member;
+		}
+		return member != nullptr;
+	}
+
+	// Announce the cache before using it, then check it wasn't replaced in the meantime,
+	// otherwise it may have been freed before the announcement was seen.
+	LookupCache *cache = type->lookup_cache.ptr.load(std::memory_order_acquire);
+	while (true) {
+		hazard->cache.store(cache);
+		LookupCache *current = type->lookup_cache.ptr.load();
+		if (current == cache) {
+			break;
+		}
+		cache = current;
+	}
+
+	if (unlikely(!cache)) {
+		// Announced while holding the lock, so it can't be retired before that.
+		lock.read_lock();
+		cache = _get_lookup_cache(type);
+		hazard->cache.store(cache);
+		lock.read_unlock();
+	}
+
+	// Copied, so the cache isn't held while calling into the object.
+	const LookupCache::Member *member = cache->members.getptr(p_name);
+	if (member) {
+		r_member = *member;
+	}
+	hazard->cache.store(nullptr, std::memory_order_release);
+	return member != nullptr;
+}
+
+void ClassDB::_clear_lookup_caches() {
+	// Must be called with the class lock held for writing, so no cache is being built.
+	if (lookup_caches.is_empty() && retired_lookup_caches.is_empty()) {
+		return;
+	}
+
+	for (KeyValue<StringName, ClassInfo> &E : classes) {
+		E.value.lookup_cache.ptr.store(nullptr);
+	}
+	for (uint32_t i = 0; i < lookup_caches.size(); i++) {
+		retired_lookup_caches.push_back(lookup_caches[i]);
+	}
+	lookup_caches.clear();
+
+	// Readers that announced a cache may still be using it, those are freed on a later call.
+	LocalVector<LookupCache *> in_use;
+	for (uint32_t i = 0; i < LOOKUP_HAZARD_SLOTS; i++) {
+		LookupCache *cache = lookup_hazards[i].cache.load();
+		if (cache) {
+			in_use.push_back(cache);
+		}
+	}
+	for (uint32_t i = 0; i < retired_lookup_caches.size();) {
+		if (in_use.find(retired_lookup_caches[i]) == -1) {
+			memdelete(retired_lookup_caches[i]);
+			retired_lookup_caches.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+}
+
 void ClassDB::bind_integer_constant(const StringName &p_class, const StringName &p_enum, const StringName &p_name, int p_constant) {
 	OBJTYPE_WLOCK;
 
@@ -548,6 +726,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 	}
 
 	type->constant_map[p_name] = p_constant;
+	_clear_lookup_caches();
 
 	String enum_name = p_enum;
 	if (!enum_name.is_empty()) {
@@ -765,6 +944,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 #endif
 
 	type->signal_map[sname] = p_signal;
+	_clear_lookup_caches();
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
@@ -870,7 +1050,9 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 
 	MethodBind *mb_set = nullptr;
 	if (p_setter) {
-		mb_set = get_method(p_class, p_setter);
+		lock.read_lock();
+		mb_set = _get_method(type, p_setter);
+		lock.read_unlock();
 #ifdef DEBUG_METHODS_ENABLED
 
 		ERR_FAIL_COND_MSG(!mb_set, "Invalid setter '" + p_class + "::" + p_setter + "' for property '" + p_pinfo.name + "'.");
@@ -882,7 +1064,9 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 
 	MethodBind *mb_get = nullptr;
 	if (p_getter) {
-		mb_get = get_method(p_class, p_getter);
+		lock.read_lock();
+		mb_get = _get_method(type, p_getter);
+		lock.read_unlock();
 #ifdef DEBUG_METHODS_ENABLED
 
 		ERR_FAIL_COND_MSG(!mb_get, "Invalid getter '" + p_class + "::" + p_getter + "' for property '" + p_pinfo.name + "'.");
@@ -917,6 +1101,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+	_clear_lookup_caches();
 }
 
 void ClassDB::set_property_default_value(const StringName &p_class, const StringName &p_name, const Variant &p_default) {
@@ -991,10 +1176,9 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+	LookupCache::Member member;
+	if (_get_member(p_object->get_class_name(), p_property, member)) {
+		const PropertySetGet *psg = member.setget;
 		if (psg) {
 			if (!psg->setter) {
 				if (r_valid) {
@@ -1030,8 +1214,6 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 
 			return true;
 		}
-
-		check = check->inherits_ptr;
 	}
 
 	return false;
@@ -1040,11 +1222,14 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
+	LookupCache::Member member;
+	if (!_get_member(p_object->get_class_name(), p_property, member)) {
+		return false;
+	}
+
+	switch (member.get_type) {
+		case LookupCache::GET_PROPERTY: {
+			const PropertySetGet *psg = member.setget;
 			if (!psg->getter) {
 				return true; //return true but do nothing
 			}
@@ -1065,43 +1250,33 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 			}
 			return true;
 		}
-
-		const int *c = check->constant_map.getptr(p_property); //constants count
-		if (c) {
-			r_value = *c;
+		case LookupCache::GET_CONSTANT: { //constants count
+			r_value = member.constant;
 			return true;
 		}
-
-		if (check->method_map.has(p_property)) { //methods count
+		case LookupCache::GET_METHOD: { //methods count
 			r_value = Callable(p_object, p_property);
 			return true;
 		}
-
-		if (check->signal_map.has(p_property)) { //signals count
+		case LookupCache::GET_SIGNAL: { //signals count
 			r_value = Signal(p_object, p_property);
 			return true;
 		}
-
-		check = check->inherits_ptr;
+		case LookupCache::GET_NONE: {
+		} break;
 	}
 
 	return false;
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
-	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (r_is_valid) {
-				*r_is_valid = true;
-			}
-
-			return psg->index;
+	LookupCache::Member member;
+	if (_get_member(p_class, p_property, member) && member.setget) {
+		if (r_is_valid) {
+			*r_is_valid = true;
 		}
 
-		check = check->inherits_ptr;
+		return member.setget->index;
 	}
 	if (r_is_valid) {
 		*r_is_valid = false;
@@ -1111,19 +1286,13 @@ int ClassDB::get_property_index(const StringName &p_class, const StringName &p_p
 }
 
 Variant::Type ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
-	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (r_is_valid) {
-				*r_is_valid = true;
-			}
-
-			return psg->type;
+	LookupCache::Member member;
+	if (_get_member(p_class, p_property, member) && member.setget) {
+		if (r_is_valid) {
+			*r_is_valid = true;
 		}
 
-		check = check->inherits_ptr;
+		return member.setget->type;
 	}
 	if (r_is_valid) {
 		*r_is_valid = false;
@@ -1190,21 +1359,20 @@ void ClassDB::set_method_flags(const StringName &p_class, const StringName &p_me
 
 bool ClassDB::has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
-		if (check->method_map.has(p_method)) {
-			return true;
-		}
-		if (p_no_inheritance) {
-			return false;
-		}
-		check = check->inherits_ptr;
+	if (!type) {
+		return false;
+	}
+	if (p_no_inheritance) {
+		return type->method_map.has(p_method);
 	}
 
-	return false;
+	LookupCache::Member member;
+	return _get_member(p_class, p_method, member) && member.method;
 }
 
 void ClassDB::bind_method_custom(const StringName &p_class, MethodBind *p_method) {
+	OBJTYPE_WLOCK;
+
 	ClassInfo *type = classes.getptr(p_class);
 	if (!type) {
 		ERR_FAIL_MSG("Couldn't bind custom method '" + p_method->get_name() + "' for instance '" + p_class + "'.");
@@ -1220,6 +1388,7 @@ void ClassDB::bind_method_custom(const StringName &p_class, MethodBind *p_method
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	_clear_lookup_caches();
 }
 
 #ifdef DEBUG_METHODS_ENABLED
@@ -1238,7 +1407,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 
 #ifdef DEBUG_ENABLED
 
-	ERR_FAIL_COND_V_MSG(has_method(instance_type, mdname), nullptr, "Class " + String(instance_type) + " already has a method " + String(mdname) + ".");
+	ERR_FAIL_COND_V_MSG(_get_method(classes.getptr(instance_type), mdname), nullptr, "Class " + String(instance_type) + " already has a method " + String(mdname) + ".");
 #endif
 
 	ClassInfo *type = classes.getptr(instance_type);
@@ -1266,6 +1435,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 #endif
 
 	type->method_map[mdname] = p_bind;
+	_clear_lookup_caches();
 
 	Vector<Variant> defvals;
 
@@ -1488,8 +1658,11 @@ void ClassDB::register_extension_class(ObjectNativeExtension *p_extension) {
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class) {
+	OBJTYPE_WLOCK;
+
 	ERR_FAIL_COND(!classes.has(p_class));
 	classes.erase(p_class);
+	_clear_lookup_caches();
 }
 
 HashMap<StringName, ClassDB::NativeStruct> ClassDB::native_structs;
@@ -1517,6 +1690,9 @@ uint64_t ClassDB::get_native_struct_size(const StringName &p_name) {
 }
 
 RWLock ClassDB::lock;
+Mutex ClassDB::lookup_cache_mutex;
+LocalVector<ClassDB::LookupCache *> ClassDB::lookup_caches;
+LocalVector<ClassDB::LookupCache *> ClassDB::retired_lookup_caches;
 
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
@@ -1534,6 +1710,14 @@ void ClassDB::cleanup() {
 		}
 	}
 	classes.clear();
+	for (uint32_t i = 0; i < lookup_caches.size(); i++) {
+		memdelete(lookup_caches[i]);
+	}
+	lookup_caches.clear();
+	for (uint32_t i = 0; i < retired_lookup_caches.size(); i++) {
+		memdelete(retired_lookup_caches[i]);
+	}
+	retired_lookup_caches.clear();
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
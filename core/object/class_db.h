@@ -38,7 +38,11 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/os/mutex.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+#include <atomic>
 
 #define DEFVAL(m_defval) (m_defval)
 
@@ -95,6 +99,37 @@ public:
 		Variant::Type type;
 	};
 
+	// Flattened view of a class and all of its parents, so a member can be found
+	// with a single hash lookup instead of walking the inheritance chain.
+	struct LookupCache {
+		enum GetType {
+			GET_NONE,
+			GET_PROPERTY,
+			GET_CONSTANT,
+			GET_METHOD,
+			GET_SIGNAL,
+		};
+
+		struct Member {
+			const PropertySetGet *setget = nullptr; // Closest property, used by set_property().
+			MethodBind *method = nullptr; // Closest method.
+			GetType get_type = GET_NONE; // What get_property() resolves to, following its lookup order.
+			int constant = 0;
+		};
+
+		HashMap<StringName, Member> members;
+	};
+
+	// Keeps ClassInfo copyable while the cache pointer is read without the class lock.
+	// Copies start without a cache, it is built again on first use.
+	struct LookupCachePtr {
+		std::atomic<LookupCache *> ptr = { nullptr };
+
+		LookupCachePtr() {}
+		LookupCachePtr(const LookupCachePtr &p_from) {}
+		void operator=(const LookupCachePtr &p_from) { ptr.store(nullptr, std::memory_order_relaxed); }
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -124,6 +159,7 @@ public:
 		bool exposed = false;
 		bool is_virtual = false;
 		Object *(*creation_func)() = nullptr;
+		LookupCachePtr lookup_cache;
 
 		ClassInfo() {}
 		~ClassInfo() {}
@@ -159,10 +195,35 @@ public:
 	};
 	static HashMap<StringName, NativeStruct> native_structs;
 
+	// Readers don't lock, they announce the cache they use in a per-thread hazard slot instead.
+	// Binding members replaces every cache, and only frees the replaced ones no slot points to.
+	enum {
+		LOOKUP_HAZARD_SLOTS = 256
+	};
+	struct LookupHazard {
+		std::atomic<bool> used = { false };
+		std::atomic<LookupCache *> cache = { nullptr };
+	};
+	struct LookupHazardRef;
+	static thread_local LookupHazardRef lookup_hazard_ref;
+	static LookupHazard lookup_hazards[LOOKUP_HAZARD_SLOTS];
+
+	static Mutex lookup_cache_mutex;
+	static LocalVector<LookupCache *> lookup_caches;
+	static LocalVector<LookupCache *> retired_lookup_caches;
+
+	static void _add_lookup_member(LookupCache *p_cache, const ClassInfo *p_type, const StringName &p_name);
+	static LookupHazard *_get_lookup_hazard();
+	static LookupCache *_get_lookup_cache(ClassInfo *p_type);
+	static bool _get_member(const StringName &p_class, const StringName &p_name, LookupCache::Member &r_member);
+	static void _clear_lookup_caches();
+
 private:
 	// Non-locking variants of get_parent_class and is_parent_class.
 	static StringName _get_parent_class(const StringName &p_class);
 	static bool _is_parent_class(const StringName &p_class, const StringName &p_inherits);
+	// Walks the inheritance chain without building a lookup cache, used while classes are being registered.
+	static MethodBind *_get_method(const ClassInfo *p_type, const StringName &p_name);
 
 public:
 	// DO NOT USE THIS!!!!!! NEEDS TO BE PUBLIC BUT DO NOT USE NO MATTER WHAT!!!
@@ -281,7 +342,11 @@ public:
 			// Overloading not supported
 			ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 		}
-		type->method_map[p_name] = bind;
+		{
+			RWLockWrite lock_write(lock);
+			type->method_map[p_name] = bind;
+			_clear_lookup_caches();
+		}
 #ifdef DEBUG_METHODS_ENABLED
 		// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 		//bind->set_return_type("Variant");
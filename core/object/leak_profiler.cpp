@@ -0,0 +1,316 @@
+/*************************************************************************/
+/*  leak_profiler.cpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "leak_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/io/resource.h"
+#include "core/object/ref_counted.h"
+#include "core/variant/variant_internal.h"
+
+Mutex LeakProfiler::mutex;
+LocalVector<ObjectID> *LeakProfiler::collected_ids = nullptr;
+
+void LeakProfiler::_collect_object(Object *p_object) {
+	collected_ids->push_back(p_object->get_instance_id());
+}
+
+void LeakProfiler::_get_object_ids(LocalVector<ObjectID> &r_ids) {
+	// Objects are only inspected once ObjectDB is unlocked again, as that can create or free other objects.
+	MutexLock lock(mutex);
+	collected_ids = &r_ids;
+	ObjectDB::debug_objects(_collect_object);
+	collected_ids = nullptr;
+}
+
+struct _ClassStatsSort {
+	_FORCE_INLINE_ bool operator()(const LeakProfiler::ClassStats &p_a, const LeakProfiler::ClassStats &p_b) const {
+		return p_a.bytes != p_b.bytes ? p_a.bytes > p_b.bytes : p_a.count > p_b.count;
+	}
+};
+
+struct _SiteStatsSort {
+	_FORCE_INLINE_ bool operator()(const LeakProfiler::SiteStats &p_a, const LeakProfiler::SiteStats &p_b) const {
+		return p_a.bytes != p_b.bytes ? p_a.bytes > p_b.bytes : p_a.count > p_b.count;
+	}
+};
+
+void LeakProfiler::get_class_stats(LocalVector<ClassStats> &r_stats) {
+	LocalVector<ObjectID> ids;
+	_get_object_ids(ids);
+
+	HashMap<StringName, uint32_t> indices;
+	for (uint32_t i = 0; i < ids.size(); i++) {
+		Object *obj = ObjectDB::get_instance(ids[i]);
+		if (!obj) {
+			continue;
+		}
+
+		StringName name = obj->get_class_name();
+		uint32_t *index = indices.getptr(name);
+		if (!index) {
+			index = &indices.insert(name, r_stats.size())->value;
+			ClassStats stats;
+			stats.name = name;
+			r_stats.push_back(stats);
+		}
+		r_stats[*index].count++;
+		r_stats[*index].bytes += obj->_alloc_size;
+	}
+
+	r_stats.sort_custom<_ClassStatsSort>();
+}
+
+void LeakProfiler::get_site_stats(LocalVector<SiteStats> &r_stats) {
+	LocalVector<ObjectID> ids;
+	_get_object_ids(ids);
+
+	HashMap<String, uint32_t> indices;
+	for (uint32_t i = 0; i < ids.size(); i++) {
+		Object *obj = ObjectDB::get_instance(ids[i]);
+		if (!obj || !obj->_alloc_file) {
+			continue;
+		}
+
+		StringName class_name = obj->get_class_name();
+		String site = String(obj->_alloc_file) + ":" + itos(obj->_alloc_line);
+		String key = site + "/" + class_name;
+		uint32_t *index = indices.getptr(key);
+		if (!index) {
+			index = &indices.insert(key, r_stats.size())->value;
+			SiteStats stats;
+			stats.site = site;
+			stats.class_name = class_name;
+			r_stats.push_back(stats);
+		}
+		r_stats[*index].count++;
+		r_stats[*index].bytes += obj->_alloc_size;
+	}
+
+	r_stats.sort_custom<_SiteStatsSort>();
+}
+
+void LeakProfiler::_scan_variant(const Variant &p_value, uint32_t p_from, CycleScan &r_scan) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Object *obj = p_value.get_validated_object();
+			if (!obj) {
+				return;
+			}
+			const uint32_t *node = r_scan.objects.getptr(obj->get_instance_id());
+			if (node) {
+				r_scan.nodes[p_from].edges.push_back(*node);
+			}
+		} break;
+		case Variant::ARRAY:
+		case Variant::DICTIONARY: {
+			bool is_array = p_value.get_type() == Variant::ARRAY;
+			const void *id = is_array ? VariantInternal::get_array(&p_value)->id() : VariantInternal::get_dictionary(&p_value)->id();
+
+			const uint32_t *node = r_scan.containers.getptr(id);
+			if (node) {
+				r_scan.nodes[p_from].edges.push_back(*node);
+				return;
+			}
+
+			uint32_t index = r_scan.nodes.size();
+			r_scan.nodes.push_back(CycleNode());
+			r_scan.nodes[index].container = p_value;
+			r_scan.containers.insert(id, index);
+			r_scan.nodes[p_from].edges.push_back(index);
+
+			if (is_array) {
+				const Array &array = *VariantInternal::get_array(&p_value);
+				for (int i = 0; i < array.size(); i++) {
+					_scan_variant(array[i], index, r_scan);
+				}
+			} else {
+				const Dictionary &dictionary = *VariantInternal::get_dictionary(&p_value);
+				List<Variant> keys;
+				dictionary.get_key_list(&keys);
+				for (const Variant &E : keys) {
+					_scan_variant(E, index, r_scan);
+					_scan_variant(dictionary[E], index, r_scan);
+				}
+			}
+		} break;
+		default: {
+		}
+	}
+}
+
+void LeakProfiler::find_reference_cycles(LocalVector<ObjectID> &r_leaked) {
+	LocalVector<ObjectID> ids;
+	_get_object_ids(ids);
+
+	// Every RefCounted object is a node, references found in its properties are edges.
+	CycleScan scan;
+	for (uint32_t i = 0; i < ids.size(); i++) {
+		if (Object::cast_to<RefCounted>(ObjectDB::get_instance(ids[i]))) {
+			scan.objects.insert(ids[i], scan.nodes.size());
+			scan.nodes.push_back(CycleNode());
+			scan.nodes[scan.nodes.size() - 1].id = ids[i];
+		}
+	}
+
+	uint32_t object_count = scan.nodes.size();
+	for (uint32_t i = 0; i < object_count; i++) {
+		Object *obj = ObjectDB::get_instance(scan.nodes[i].id);
+		if (!obj) {
+			continue;
+		}
+
+		List<PropertyInfo> properties;
+		obj->get_property_list(&properties);
+		for (const PropertyInfo &E : properties) {
+			// Script members that aren't exported are only marked as script variables.
+			if (!(E.usage & (PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_SCRIPT_VARIABLE))) {
+				continue;
+			}
+			if (E.type != Variant::NIL && E.type != Variant::OBJECT && E.type != Variant::ARRAY && E.type != Variant::DICTIONARY) {
+				continue;
+			}
+
+			bool valid = false;
+			Variant value = obj->get(E.name, &valid);
+			if (valid) {
+				_scan_variant(value, i, scan);
+			}
+		}
+	}
+
+	// References not explained by edges come from somewhere else, those nodes are the roots.
+	for (uint32_t i = 0; i < scan.nodes.size(); i++) {
+		CycleNode &node = scan.nodes[i];
+		if (node.id.is_valid()) {
+			RefCounted *rc = Object::cast_to<RefCounted>(ObjectDB::get_instance(node.id));
+			// Objects freed while scanning can't be leaked.
+			node.refs = rc ? rc->reference_get_count() : 1;
+		} else {
+			// Not counting the reference held by the scan itself.
+			node.refs = node.container.get_type() == Variant::ARRAY ? VariantInternal::get_array(&node.container)->get_reference_count() - 1 : VariantInternal::get_dictionary(&node.container)->get_reference_count() - 1;
+		}
+	}
+	for (uint32_t i = 0; i < scan.nodes.size(); i++) {
+		for (uint32_t j = 0; j < scan.nodes[i].edges.size(); j++) {
+			scan.nodes[scan.nodes[i].edges[j]].refs--;
+		}
+	}
+
+	LocalVector<uint32_t> pending;
+	for (uint32_t i = 0; i < scan.nodes.size(); i++) {
+		if (scan.nodes[i].refs > 0) {
+			scan.nodes[i].reachable = true;
+			pending.push_back(i);
+		}
+	}
+	while (pending.size()) {
+		uint32_t index = pending[pending.size() - 1];
+		pending.resize(pending.size() - 1);
+		for (uint32_t j = 0; j < scan.nodes[index].edges.size(); j++) {
+			CycleNode &target = scan.nodes[scan.nodes[index].edges[j]];
+			if (!target.reachable) {
+				target.reachable = true;
+				pending.push_back(scan.nodes[index].edges[j]);
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < object_count; i++) {
+		if (!scan.nodes[i].reachable && ObjectDB::get_instance(scan.nodes[i].id)) {
+			r_leaked.push_back(scan.nodes[i].id);
+		}
+	}
+}
+
+Dictionary LeakProfiler::get_report() {
+	Dictionary report;
+
+	LocalVector<ClassStats> class_stats;
+	get_class_stats(class_stats);
+	Array classes;
+	for (uint32_t i = 0; i < class_stats.size(); i++) {
+		Dictionary entry;
+		entry["class"] = class_stats[i].name;
+		entry["count"] = class_stats[i].count;
+		entry["bytes"] = class_stats[i].bytes;
+		classes.push_back(entry);
+	}
+	report["classes"] = classes;
+
+	LocalVector<SiteStats> site_stats;
+	get_site_stats(site_stats);
+	Array sites;
+	for (uint32_t i = 0; i < site_stats.size(); i++) {
+		Dictionary entry;
+		entry["site"] = site_stats[i].site;
+		entry["class"] = site_stats[i].class_name;
+		entry["count"] = site_stats[i].count;
+		entry["bytes"] = site_stats[i].bytes;
+		sites.push_back(entry);
+	}
+	report["allocation_sites"] = sites;
+
+	LocalVector<ObjectID> leaked;
+	find_reference_cycles(leaked);
+	Array cycles;
+	for (uint32_t i = 0; i < leaked.size(); i++) {
+		Object *obj = ObjectDB::get_instance(leaked[i]);
+		if (!obj) {
+			continue;
+		}
+		Dictionary entry;
+		entry["id"] = uint64_t(leaked[i]);
+		entry["class"] = obj->get_class_name();
+		Resource *res = Object::cast_to<Resource>(obj);
+		entry["path"] = res ? res->get_path() : String();
+		entry["site"] = obj->_alloc_file ? String(obj->_alloc_file) + ":" + itos(obj->_alloc_line) : String();
+		cycles.push_back(entry);
+	}
+	report["reference_cycles"] = cycles;
+
+	return report;
+}
+
+Error LeakProfiler::save_report(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't save object report to file: " + p_path + ".");
+
+	Ref<JSON> json;
+	json.instantiate();
+	f->store_string(json->stringify(get_report(), "\t", false));
+	return OK;
+}
+
+#endif // DEBUG_ENABLED
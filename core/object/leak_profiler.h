@@ -0,0 +1,94 @@
+/*************************************************************************/
+/*  leak_profiler.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef LEAK_PROFILER_H
+#define LEAK_PROFILER_H
+
+#include "core/object/object.h"
+#include "core/templates/local_vector.h"
+
+#ifdef DEBUG_ENABLED
+
+// Debug build diagnostics to find out what keeps memory alive, using ObjectDB and the
+// allocation site and size memnew() records in every object.
+class LeakProfiler {
+public:
+	struct ClassStats {
+		StringName name;
+		uint32_t count = 0;
+		uint64_t bytes = 0; // Size of the objects themselves, not the memory they own.
+	};
+
+	struct SiteStats {
+		String site;
+		StringName class_name;
+		uint32_t count = 0;
+		uint64_t bytes = 0;
+	};
+
+private:
+	struct CycleNode {
+		ObjectID id; // Null for containers.
+		Variant container; // Held while scanning, so its address can't be reused by another container.
+		int64_t refs = 0; // References from outside the scanned graph.
+		LocalVector<uint32_t> edges;
+		bool reachable = false;
+	};
+
+	struct CycleScan {
+		LocalVector<CycleNode> nodes;
+		HashMap<ObjectID, uint32_t> objects;
+		HashMap<const void *, uint32_t> containers;
+	};
+
+	static Mutex mutex;
+	static LocalVector<ObjectID> *collected_ids;
+
+	static void _collect_object(Object *p_object);
+	static void _get_object_ids(LocalVector<ObjectID> &r_ids);
+	static void _scan_variant(const Variant &p_value, uint32_t p_from, CycleScan &r_scan);
+
+public:
+	// Live objects per class and per memnew() call site, largest first.
+	static void get_class_stats(LocalVector<ClassStats> &r_stats);
+	static void get_site_stats(LocalVector<SiteStats> &r_stats);
+
+	// Finds RefCounted objects that are only referenced from other unreachable RefCounted objects,
+	// so they will never be freed. Only references stored in properties, script variables, metadata and the
+	// containers in them are followed, anything else counts as a reference from outside.
+	static void find_reference_cycles(LocalVector<ObjectID> &r_leaked);
+
+	static Dictionary get_report();
+	static Error save_report(const String &p_path);
+};
+
+#endif // DEBUG_ENABLED
+
+#endif // LEAK_PROFILER_H
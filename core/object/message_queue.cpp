@@ -30,72 +30,145 @@
 
 #include "message_queue.h"
 
-#include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
 
 MessageQueue *MessageQueue::singleton = nullptr;
 
+// Buffer used by the current thread. A thread that exits gives its buffer back, so it can be
+// reused by a new thread once any messages left in it are flushed.
+struct MessageQueue::ThreadBufferRef {
+	ThreadBuffer *buffer = nullptr;
+	uint32_t generation = 0; // Queue the buffer belongs to, in case the queue is recreated.
+
+	~ThreadBufferRef() {
+		MessageQueue *queue = singleton;
+		if (buffer && queue && generation == MessageQueue::generation) {
+			MutexLock lock(queue->buffers_mutex);
+			buffer->owned = false;
+		}
+		buffer = nullptr;
+	}
+};
+
+thread_local MessageQueue::ThreadBufferRef MessageQueue::thread_buffer_ref;
+uint32_t MessageQueue::generation = 0;
+
 MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
+MessageQueue::ThreadBuffer *MessageQueue::_get_thread_buffer() {
+	ThreadBufferRef &ref = thread_buffer_ref;
+	if (likely(ref.buffer && ref.generation == generation)) {
+		return ref.buffer;
+	}
+
+	MutexLock lock(buffers_mutex);
+
+	ThreadBuffer *buffer = nullptr;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		if (!buffers[i]->owned) {
+			buffer = buffers[i];
+			break;
+		}
+	}
+
+	if (!buffer) {
+		buffer = memnew(ThreadBuffer);
+		buffer->first_page = memnew(Page);
+		buffer->write_page = buffer->first_page;
+		buffer->read_page = buffer->first_page;
+		buffers.push_back(buffer);
+	}
+
+	buffer->owned = true;
+	ref.buffer = buffer;
+	ref.generation = generation;
+	return buffer;
+}
+
+MessageQueue::Message *MessageQueue::_alloc_message(ThreadBuffer *p_buffer, uint32_t p_size) {
+	// Must be called with the buffer locked.
+	if (p_buffer->write_pos + p_size > PAGE_SIZE) {
+		ERR_FAIL_COND_V_MSG(p_size > PAGE_SIZE, nullptr, "Message is too large for the message queue, it has too many arguments.");
+
+		// Continue on the next page, allocating it if the queue never grew this far before.
+		p_buffer->write_page->end = p_buffer->write_pos;
+		if (!p_buffer->write_page->next) {
+			p_buffer->write_page->next = memnew(Page);
+		}
+		p_buffer->write_page = p_buffer->write_page->next;
+		p_buffer->write_pos = 0;
+	}
+
+	Message *msg = memnew_placement(&p_buffer->write_page->data[p_buffer->write_pos], Message);
+	p_buffer->write_pos += p_size;
+	p_buffer->used += p_size;
+	return msg;
+}
+
+uint32_t MessageQueue::_get_message_size(const Message *p_message) {
+	uint32_t size = sizeof(Message);
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		size += sizeof(Variant) * p_message->args;
+	}
+	return size;
+}
+
+void MessageQueue::_free_message(Message *p_message) {
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int i = 0; i < p_message->args; i++) {
+			args[i].~Variant();
+		}
+	}
+	p_message->~Message();
+}
+
 Error MessageQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
 
 Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	_THREAD_SAFE_METHOD_
+	ThreadBuffer *buffer = _get_thread_buffer();
+	buffer->lock.lock();
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
-		String type;
-		if (ObjectDB::get_instance(p_id)) {
-			type = ObjectDB::get_instance(p_id)->get_class();
-		}
-		print_line("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
+	Message *msg = _alloc_message(buffer, sizeof(Message) + sizeof(Variant));
+	if (!msg) {
+		buffer->lock.unlock();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
-	*v = p_value;
+	memnew_placement(msg + 1, Variant(p_value));
 
+	buffer->lock.unlock();
 	return OK;
 }
 
 Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
-	_THREAD_SAFE_METHOD_
-
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
-	uint8_t room_needed = sizeof(Message);
+	ThreadBuffer *buffer = _get_thread_buffer();
+	buffer->lock.lock();
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
+	Message *msg = _alloc_message(buffer, sizeof(Message));
+	if (!msg) {
+		buffer->lock.unlock();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
-
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
 
-	buffer_end += sizeof(Message);
-
+	buffer->lock.unlock();
 	return OK;
 }
 
@@ -112,17 +185,15 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 }
 
 Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	_THREAD_SAFE_METHOD_
-
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+	ThreadBuffer *buffer = _get_thread_buffer();
+	buffer->lock.lock();
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed method: " + p_callable);
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
+	Message *msg = _alloc_message(buffer, sizeof(Message) + sizeof(Variant) * p_argcount);
+	if (!msg) {
+		buffer->lock.unlock();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -130,14 +201,12 @@ Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p
 		msg->type |= FLAG_SHOW_ERROR;
 	}
 
-	buffer_end += sizeof(Message);
-
+	Variant *args = (Variant *)(msg + 1);
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
-		*v = *p_args[i];
+		memnew_placement(&args[i], Variant(*p_args[i]));
 	}
 
+	buffer->lock.unlock();
 	return OK;
 }
 
@@ -146,56 +215,71 @@ void MessageQueue::statistics() {
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
 	int null_count = 0;
+	uint32_t total_bytes = 0;
+
+	MutexLock buffers_lock(buffers_mutex);
+
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		ThreadBuffer *buffer = buffers[i];
+		buffer->lock.lock();
+		total_bytes += buffer->used;
+
+		Page *page = buffer->read_page;
+		uint32_t read_pos = buffer->read_pos;
+		while (page != buffer->write_page || read_pos < buffer->write_pos) {
+			if (page != buffer->write_page && read_pos >= page->end) {
+				page = page->next;
+				read_pos = 0;
+				continue;
+			}
 
-	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+			Message *message = (Message *)&page->data[read_pos];
 
-		Object *target = message->callable.get_object();
+			Object *target = message->callable.get_object();
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (!call_count.has(message->callable)) {
-						call_count[message->callable] = 0;
-					}
+			if (target != nullptr) {
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						if (!call_count.has(message->callable)) {
+							call_count[message->callable] = 0;
+						}
 
-					call_count[message->callable]++;
+						call_count[message->callable]++;
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (!notify_count.has(message->notification)) {
-						notify_count[message->notification] = 0;
-					}
+					} break;
+					case TYPE_NOTIFICATION: {
+						if (!notify_count.has(message->notification)) {
+							notify_count[message->notification] = 0;
+						}
 
-					notify_count[message->notification]++;
+						notify_count[message->notification]++;
 
-				} break;
-				case TYPE_SET: {
-					StringName t = message->callable.get_method();
-					if (!set_count.has(t)) {
-						set_count[t] = 0;
-					}
+					} break;
+					case TYPE_SET: {
+						StringName t = message->callable.get_method();
+						if (!set_count.has(t)) {
+							set_count[t] = 0;
+						}
 
-					set_count[t]++;
+						set_count[t]++;
 
-				} break;
-			}
+					} break;
+				}
 
-		} else {
-			//object was deleted
-			print_line("Object was deleted while awaiting a callback");
+			} else {
+				//object was deleted
+				print_line("Object was deleted while awaiting a callback");
 
-			null_count++;
-		}
+				null_count++;
+			}
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+			read_pos += _get_message_size(message);
 		}
+
+		buffer->lock.unlock();
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	print_line("TOTAL BYTES: " + itos(total_bytes));
 	print_line("NULL count: " + itos(null_count));
 
 	for (const KeyValue<StringName, int> &E : set_count) {
@@ -232,36 +316,43 @@ void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_a
 	}
 }
 
-void MessageQueue::flush() {
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
-	}
-
-	uint32_t read_pos = 0;
-
-	//using reverse locking strategy
-	_THREAD_SAFE_LOCK_
-
-	if (flushing) {
-		_THREAD_SAFE_UNLOCK_
-		ERR_FAIL_COND(flushing); //already flushing, you did something odd
-	}
-	flushing = true;
-
-	while (read_pos < buffer_end) {
-		//lock on each iteration, so a call can re-add itself to the message queue
-
-		Message *message = (Message *)&buffer[read_pos];
+bool MessageQueue::_flush_buffer(ThreadBuffer *p_buffer) {
+	// Only flush what was queued so far, messages added while flushing run on the next pass.
+	p_buffer->lock.lock();
+	Page *end_page = p_buffer->write_page;
+	uint32_t end_pos = p_buffer->write_pos;
+	p_buffer->lock.unlock();
+
+	bool flushed = false;
+
+	while (p_buffer->read_page != end_page || p_buffer->read_pos < end_pos) {
+		if (p_buffer->read_page != end_page && p_buffer->read_pos >= p_buffer->read_page->end) {
+			// Move the consumed page to the end of the chain, so calls that keep queuing
+			// more calls while flushing reuse pages instead of growing the queue forever.
+			p_buffer->lock.lock();
+			Page *page = p_buffer->read_page;
+			p_buffer->read_page = page->next;
+			p_buffer->first_page = page->next;
+			p_buffer->used -= page->end;
+
+			Page *last = p_buffer->write_page;
+			while (last->next) {
+				last = last->next;
+			}
+			last->next = page;
+			page->next = nullptr;
+			page->end = 0;
+			p_buffer->lock.unlock();
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
+			p_buffer->read_pos = 0;
+			continue;
 		}
 
-		//pre-advance so this function is reentrant
-		read_pos += advance;
+		Message *message = (Message *)&p_buffer->read_page->data[p_buffer->read_pos];
 
-		_THREAD_SAFE_UNLOCK_
+		//pre-advance so a call can add new messages to the queue
+		p_buffer->read_pos += _get_message_size(message);
+		flushed = true;
 
 		Object *target = message->callable.get_object();
 
@@ -289,21 +380,63 @@ void MessageQueue::flush() {
 			}
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int i = 0; i < message->args; i++) {
-				args[i].~Variant();
-			}
-		}
+		_free_message(message);
+	}
+
+	// Rewind the buffer if nothing was added meanwhile, so its pages get reused.
+	p_buffer->lock.lock();
+	if (p_buffer->read_page == p_buffer->write_page && p_buffer->read_pos == p_buffer->write_pos) {
+		p_buffer->write_page = p_buffer->first_page;
+		p_buffer->write_pos = 0;
+		p_buffer->read_page = p_buffer->first_page;
+		p_buffer->read_pos = 0;
+		p_buffer->used = 0;
+	}
+	p_buffer->lock.unlock();
+
+	return flushed;
+}
+
+void MessageQueue::flush() {
+	buffers_mutex.lock();
+
+	if (flushing) {
+		buffers_mutex.unlock();
+		ERR_FAIL_COND(flushing); //already flushing, you did something odd
+	}
+	flushing = true;
+
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		buffers[i]->lock.lock();
+		used += buffers[i]->used;
+		buffers[i]->lock.unlock();
+	}
+	if (used > buffer_max_used) {
+		buffer_max_used = used;
+	}
 
-		message->~Message();
+	buffers_mutex.unlock();
 
-		_THREAD_SAFE_LOCK_
+	// Keep going until no thread has anything left, as calls can queue more messages.
+	bool flushed = true;
+	while (flushed) {
+		flushed = false;
+		for (uint32_t i = 0;; i++) {
+			buffers_mutex.lock();
+			ThreadBuffer *buffer = i < buffers.size() ? buffers[i] : nullptr;
+			buffers_mutex.unlock();
+
+			if (!buffer) {
+				break;
+			}
+			if (_flush_buffer(buffer)) {
+				flushed = true;
+			}
+		}
 	}
 
-	buffer_end = 0; // reset buffer
 	flushing = false;
-	_THREAD_SAFE_UNLOCK_
 }
 
 bool MessageQueue::is_flushing() const {
@@ -313,33 +446,39 @@ bool MessageQueue::is_flushing() const {
 MessageQueue::MessageQueue() {
 	ERR_FAIL_COND_MSG(singleton != nullptr, "A MessageQueue singleton already exists.");
 	singleton = this;
+	generation++;
 
-	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
-	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
-	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+	// The thread creating the queue gets the first buffer, so its messages are flushed first.
+	_get_thread_buffer();
 }
 
 MessageQueue::~MessageQueue() {
-	uint32_t read_pos = 0;
-
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
-		Variant *args = (Variant *)(message + 1);
-		int argc = message->args;
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			for (int i = 0; i < argc; i++) {
-				args[i].~Variant();
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		ThreadBuffer *buffer = buffers[i];
+
+		Page *page = buffer->read_page;
+		uint32_t read_pos = buffer->read_pos;
+		while (page != buffer->write_page || read_pos < buffer->write_pos) {
+			if (page != buffer->write_page && read_pos >= page->end) {
+				page = page->next;
+				read_pos = 0;
+				continue;
 			}
+
+			Message *message = (Message *)&page->data[read_pos];
+			read_pos += _get_message_size(message);
+			_free_message(message);
 		}
-		message->~Message();
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+		page = buffer->first_page;
+		while (page) {
+			Page *next = page->next;
+			memdelete(page);
+			page = next;
 		}
+		memdelete(buffer);
 	}
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
+	generation++;
 }
@@ -32,16 +32,16 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object/object_id.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class Object;
 
 class MessageQueue {
-	_THREAD_SAFE_CLASS_
-
 	enum {
-		DEFAULT_QUEUE_SIZE_KB = 4096
+		PAGE_SIZE = 65536
 	};
 
 	enum {
@@ -62,10 +62,39 @@ class MessageQueue {
 		};
 	};
 
-	uint8_t *buffer = nullptr;
-	uint32_t buffer_end = 0;
+	// Messages are stored in a chain of pages that grows as needed. Messages never cross pages.
+	struct Page {
+		uint8_t data[PAGE_SIZE];
+		uint32_t end = 0; // Bytes used, once writing moved on to the next page.
+		Page *next = nullptr;
+	};
+
+	// Each thread appends to its own buffer, so threads only contend with the flush, never with each other.
+	struct ThreadBuffer {
+		SpinLock lock;
+		Page *first_page = nullptr; // Always the read page, consumed pages are moved to the end of the chain.
+		Page *write_page = nullptr;
+		uint32_t write_pos = 0;
+		Page *read_page = nullptr; // Only used by flush().
+		uint32_t read_pos = 0;
+		uint32_t used = 0;
+		bool owned = false;
+	};
+
+	struct ThreadBufferRef;
+	static thread_local ThreadBufferRef thread_buffer_ref;
+	static uint32_t generation;
+
+	// Buffers are flushed in the order they were created, starting with the thread that created the queue.
+	Mutex buffers_mutex;
+	LocalVector<ThreadBuffer *> buffers;
 	uint32_t buffer_max_used = 0;
-	uint32_t buffer_size = 0;
+
+	ThreadBuffer *_get_thread_buffer();
+	Message *_alloc_message(ThreadBuffer *p_buffer, uint32_t p_size);
+	bool _flush_buffer(ThreadBuffer *p_buffer);
+	static uint32_t _get_message_size(const Message *p_message);
+	static void _free_message(Message *p_message);
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
@@ -91,6 +120,10 @@ public:
 	Error push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value);
 	Error push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
 
+	Error push_callable(const Callable &p_callable) {
+		return push_callablep(p_callable, nullptr, 0);
+	}
+
 	template <typename... VarArgs>
 	Error push_callable(const Callable &p_callable, VarArgs... p_args) {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
@@ -1053,6 +1053,10 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 }
 
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
+	return _emit_signalp(p_name, p_args, p_argcount, nullptr);
+}
+
+Error Object::_emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount, const SignalPtrcallArgs *p_ptrcall_args) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
@@ -1073,18 +1077,39 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	//copy on write will ensure that disconnecting the signal or even deleting the object will not affect the signal calling.
 	//this happens automatically and will not change the performance of calling.
 	//awesome, isn't it?
-	VMap<Callable, SignalData::Slot> slot_map = s->slot_map;
+	//the copy must stay const, a non-const access would trigger the actual copy on every emission.
+	const VMap<Callable, SignalData::Slot> slot_map = s->slot_map;
 
 	int ssize = slot_map.size();
+	if (ssize == 0) {
+		return OK;
+	}
 
 	OBJ_DEBUG_LOCK
 
-	Vector<const Variant *> bind_mem;
+	// Arguments and binds are gathered on the stack, sized for the connection with the most binds.
+	int max_binds = 0;
+	for (int i = 0; i < ssize; i++) {
+		max_binds = MAX(max_binds, slot_map.getv(i).conn.binds.size());
+	}
+	const Variant **bind_mem = max_binds > 0 ? (const Variant **)alloca(sizeof(Variant *) * (p_argcount + max_binds)) : nullptr;
 
 	Error err = OK;
 
+	// When emitted with C++ arguments, Variants are only built for the first callable that needs them.
+	Variant *ptrcall_variants = nullptr;
+	if (p_ptrcall_args && p_argcount > 0) {
+		ptrcall_variants = (Variant *)alloca(sizeof(Variant) * p_argcount);
+		p_args = (const Variant **)alloca(sizeof(Variant *) * p_argcount);
+		for (int i = 0; i < p_argcount; i++) {
+			p_args[i] = &ptrcall_variants[i];
+		}
+	}
+	bool ptrcall_variants_built = false;
+
 	for (int i = 0; i < ssize; i++) {
-		const Connection &c = slot_map.getv(i).conn;
+		const SignalData::Slot &slot = slot_map.getv(i);
+		const Connection &c = slot.conn;
 
 		Object *target = c.callable.get_object();
 		if (!target) {
@@ -1092,26 +1117,37 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			continue;
 		}
 
+		// Callables taking the same C++ arguments the signal was emitted with are called directly.
+		bool ptrcall = p_ptrcall_args && slot.ptrcall_signature == p_ptrcall_args->signature && !c.binds.size() && !(c.flags & CONNECT_DEFERRED);
+		if (p_ptrcall_args && !ptrcall && !ptrcall_variants_built) {
+			if (p_argcount > 0) {
+				p_ptrcall_args->to_variants(p_ptrcall_args->args, ptrcall_variants);
+			}
+			ptrcall_variants_built = true;
+		}
+
 		const Variant **args = p_args;
 		int argc = p_argcount;
 
 		if (c.binds.size()) {
 			//handle binds
-			bind_mem.resize(p_argcount + c.binds.size());
-
 			for (int j = 0; j < p_argcount; j++) {
-				bind_mem.write[j] = p_args[j];
+				bind_mem[j] = p_args[j];
 			}
 			for (int j = 0; j < c.binds.size(); j++) {
-				bind_mem.write[p_argcount + j] = &c.binds[j];
+				bind_mem[p_argcount + j] = &c.binds[j];
 			}
 
-			args = (const Variant **)bind_mem.ptr();
-			argc = bind_mem.size();
+			args = bind_mem;
+			argc = p_argcount + c.binds.size();
 		}
 
 		if (c.flags & CONNECT_DEFERRED) {
 			MessageQueue::get_singleton()->push_callablep(c.callable, args, argc, true);
+		} else if (ptrcall) {
+			_emitting = true;
+			c.callable.ptrcall(p_ptrcall_args->args);
+			_emitting = false;
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
@@ -1156,6 +1192,12 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		disconnect_data.pop_front();
 	}
 
+	if (ptrcall_variants_built) {
+		for (int i = 0; i < p_argcount; i++) {
+			ptrcall_variants[i].~Variant();
+		}
+	}
+
 	return err;
 }
 
@@ -1353,6 +1395,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, co
 	conn.binds = p_binds;
 	slot.conn = conn;
 	slot.cE = target_object->connections.push_back(conn);
+	slot.ptrcall_signature = target.get_ptrcall_signature();
 	if (p_flags & CONNECT_REFERENCE_COUNTED) {
 		slot.reference_count = 1;
 	}
@@ -1907,17 +1950,29 @@ bool predelete_handler(Object *p_object) {
 	return p_object->_predelete();
 }
 
-void postinitialize_handler(Object *p_object) {
+void postinitialize_handler(Object *p_object, const char *p_file, int p_line, size_t p_size) {
+#ifdef DEBUG_ENABLED
+	p_object->_alloc_file = p_file;
+	p_object->_alloc_line = p_line;
+	p_object->_alloc_size = p_size;
+#endif
 	p_object->_postinitialize();
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
-			count--;
+	for (uint32_t i = 0; i < slot_max; i++) {
+		ObjectSlot &object_slot = _get_slot(i);
+		uint64_t validator = object_slot.validator.load(std::memory_order_acquire);
+		if (!validator) {
+			continue;
+		}
+
+		// remove_instance() doesn't take the lock, so look the object up again in case it was freed meanwhile.
+		Object *object = get_instance(ObjectID(uint64_t(i) | (validator << OBJECTDB_SLOT_MAX_COUNT_BITS)));
+		if (object) {
+			p_func(object);
 		}
 	}
 	spin_lock.unlock();
@@ -1926,46 +1981,151 @@ void ObjectDB::debug_objects(DebugFunc p_func) {
 void Object::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 }
 
+#define OBJECTDB_FREE_SLOT_BATCH 64
+#define OBJECTDB_FREE_SLOT_NONE UINT32_MAX
+
+// Free slots owned by a thread, so adding and removing objects rarely needs the lock.
+struct ObjectDB::ThreadFreeSlots {
+	uint32_t head = OBJECTDB_FREE_SLOT_NONE;
+	uint32_t count = 0;
+	bool destroyed = false;
+
+	~ThreadFreeSlots() {
+		if (count && slot_max) {
+			_release_free_slots(head, count);
+		}
+		head = OBJECTDB_FREE_SLOT_NONE;
+		count = 0;
+		// Objects can still be freed by other thread-local destructors after this one ran.
+		destroyed = true;
+	}
+};
+
 SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
+SafeNumeric<uint32_t> ObjectDB::slot_count;
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_pages[OBJECTDB_MAX_SLOT_PAGES] = {};
+uint32_t ObjectDB::free_slots = OBJECTDB_FREE_SLOT_NONE;
+uint32_t ObjectDB::free_slot_count = 0;
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+thread_local ObjectDB::ThreadFreeSlots ObjectDB::thread_free_slots;
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return slot_count.get();
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+uint32_t ObjectDB::_alloc_slot() {
+	ThreadFreeSlots &local = thread_free_slots;
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	if (unlikely(local.count == 0)) {
+		spin_lock.lock();
+
+		if (free_slot_count == 0) {
+			CRASH_COND(slot_max == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+
+			ObjectSlot *page = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_SLOT_PAGE_SIZE);
+			for (uint32_t i = 0; i < OBJECTDB_SLOT_PAGE_SIZE; i++) {
+				ObjectSlot *object_slot = memnew_placement(&page[i], ObjectSlot);
+				object_slot->validator.store(0, std::memory_order_relaxed);
+				object_slot->object.store(nullptr, std::memory_order_relaxed);
+				object_slot->next_free = i + 1 < OBJECTDB_SLOT_PAGE_SIZE ? slot_max + i + 1 : free_slots;
+				object_slot->is_ref_counted = false;
+			}
+			slot_pages[slot_max >> OBJECTDB_SLOT_PAGE_BITS].store(page, std::memory_order_release);
+
+			free_slots = slot_max;
+			free_slot_count += OBJECTDB_SLOT_PAGE_SIZE;
+			slot_max += OBJECTDB_SLOT_PAGE_SIZE;
 		}
-		slot_max = new_slot_max;
-	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+		if (unlikely(local.destroyed)) {
+			// The thread is exiting, don't hand slots to a list nobody will give back.
+			uint32_t slot = free_slots;
+			free_slots = _get_slot(slot).next_free;
+			free_slot_count--;
+			spin_lock.unlock();
+			return slot;
+		}
+
+		uint32_t taken = MIN(free_slot_count, (uint32_t)OBJECTDB_FREE_SLOT_BATCH);
+		uint32_t tail = free_slots;
+		for (uint32_t i = 1; i < taken; i++) {
+			tail = _get_slot(tail).next_free;
+		}
+		local.head = free_slots;
+		local.count = taken;
+		free_slots = _get_slot(tail).next_free;
+		free_slot_count -= taken;
+		_get_slot(tail).next_free = OBJECTDB_FREE_SLOT_NONE;
+
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+
+	uint32_t slot = local.head;
+	local.head = _get_slot(slot).next_free;
+	local.count--;
+	return slot;
+}
+
+void ObjectDB::_free_slot(uint32_t p_slot) {
+	ThreadFreeSlots &local = thread_free_slots;
+
+	if (unlikely(local.destroyed)) {
+		_get_slot(p_slot).next_free = OBJECTDB_FREE_SLOT_NONE;
+		_release_free_slots(p_slot, 1);
+		return;
+	}
+
+	_get_slot(p_slot).next_free = local.head;
+	local.head = p_slot;
+	local.count++;
+
+	if (unlikely(local.count > OBJECTDB_FREE_SLOT_BATCH * 2)) {
+		// Keep the most recently freed slots and share the rest, objects are often freed on other threads than they were created on.
+		uint32_t last_kept = local.head;
+		for (uint32_t i = 1; i < OBJECTDB_FREE_SLOT_BATCH; i++) {
+			last_kept = _get_slot(last_kept).next_free;
+		}
+		uint32_t released = _get_slot(last_kept).next_free;
+		_get_slot(last_kept).next_free = OBJECTDB_FREE_SLOT_NONE;
+		_release_free_slots(released, local.count - OBJECTDB_FREE_SLOT_BATCH);
+		local.count = OBJECTDB_FREE_SLOT_BATCH;
+	}
+}
+
+void ObjectDB::_release_free_slots(uint32_t p_head, uint32_t p_count) {
+	uint32_t tail = p_head;
+	for (uint32_t i = 1; i < p_count; i++) {
+		tail = _get_slot(tail).next_free;
+	}
+
+	spin_lock.lock();
+	_get_slot(tail).next_free = free_slots;
+	free_slots = p_head;
+	free_slot_count += p_count;
+	spin_lock.unlock();
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	uint32_t slot = _alloc_slot();
+	ObjectSlot &object_slot = _get_slot(slot);
+
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
+		_free_slot(slot);
+		ERR_FAIL_V(ObjectID());
+	}
+
+	uint64_t validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(validator == 0)) {
+		validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	object_slot.is_ref_counted = p_object->is_ref_counted();
+	// The object must be visible before the validator which makes lookups accept it.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator, std::memory_order_release);
+
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -1973,9 +2133,7 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
-
-	spin_lock.unlock();
+	slot_count.increment();
 
 	return ObjectID(id);
 }
@@ -1983,34 +2141,25 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
-
-	spin_lock.lock();
+	ObjectSlot &object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+		ERR_FAIL_COND(object_slot.validator.load(std::memory_order_relaxed) != validator);
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.validator.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_release);
+	object_slot.is_ref_counted = false;
 
-	spin_lock.unlock();
+	slot_count.decrement();
+
+	_free_slot(slot);
 }
 
 void ObjectDB::setup() {
@@ -2018,9 +2167,9 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	if (slot_count > 0) {
-		spin_lock.lock();
+	spin_lock.lock();
 
+	if (slot_count.get() > 0) {
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
@@ -2030,9 +2179,11 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count.get(); i < slot_max && count != 0; i++) {
+				ObjectSlot &object_slot = _get_slot(i);
+				uint64_t validator = object_slot.validator.load(std::memory_order_acquire);
+				if (validator) {
+					Object *obj = object_slot.object.load(std::memory_order_acquire);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2042,7 +2193,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_VALIDATOR_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (validator << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slot.is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(id) + extra_info);
 
 					count--;
@@ -2050,10 +2201,19 @@ void ObjectDB::cleanup() {
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
-		spin_lock.unlock();
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max; i += OBJECTDB_SLOT_PAGE_SIZE) {
+		ObjectSlot *page = slot_pages[i >> OBJECTDB_SLOT_PAGE_BITS].exchange(nullptr);
+		memfree(page);
 	}
+	slot_max = 0;
+	free_slots = OBJECTDB_FREE_SLOT_NONE;
+	free_slot_count = 0;
+
+	// Other threads are gone by now, only the free slots of this one still refer to the pages.
+	thread_free_slots.head = OBJECTDB_FREE_SLOT_NONE;
+	thread_free_slots.count = 0;
+
+	spin_lock.unlock();
 }
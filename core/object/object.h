@@ -479,7 +479,10 @@ private:
 	friend struct _ObjectDebugLock;
 #endif
 	friend bool predelete_handler(Object *);
-	friend void postinitialize_handler(Object *);
+	friend void postinitialize_handler(Object *, const char *, int, size_t);
+#ifdef DEBUG_ENABLED
+	friend class LeakProfiler;
+#endif
 
 	ObjectNativeExtension *_extension = nullptr;
 	GDExtensionClassInstancePtr _extension_instance = nullptr;
@@ -489,6 +492,7 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			const void *ptrcall_signature = nullptr; // Set when the callable can be called with C++ arguments, see Callable::ptrcall().
 		};
 
 		MethodInfo user;
@@ -499,6 +503,10 @@ private:
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
+	// Where memnew() created the object and the size of its class, unknown for objects created in other ways.
+	const char *_alloc_file = nullptr;
+	int _alloc_line = 0;
+	uint32_t _alloc_size = 0;
 #endif
 	bool _block_signals = false;
 	int _predelete_ok = 0;
@@ -522,6 +530,27 @@ private:
 	void _add_user_signal(const String &p_name, const Array &p_args = Array());
 	bool _has_user_signal(const StringName &p_name) const;
 	Error _emit_signal(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+
+	// C++ arguments of a signal emitted by the engine, converted to Variants only when needed.
+	struct SignalPtrcallArgs {
+		const void *signature = nullptr;
+		const void **args = nullptr;
+		void (*to_variants)(const void **p_args, Variant *r_variants) = nullptr;
+	};
+
+	template <typename... VarArgs, size_t... Is>
+	static void _ptrcall_args_to_variants_helper(const void **p_args, Variant *r_variants, IndexSequence<Is...>) {
+		(memnew_placement(&r_variants[Is], Variant(*reinterpret_cast<const VarArgs *>(p_args[Is]))), ...);
+		(void)(p_args); //avoid warning
+		(void)(r_variants);
+	}
+
+	template <typename... VarArgs>
+	static void _ptrcall_args_to_variants(const void **p_args, Variant *r_variants) {
+		_ptrcall_args_to_variants_helper<VarArgs...>(p_args, r_variants, BuildIndexSequence<sizeof...(VarArgs)>{});
+	}
+
+	Error _emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount, const SignalPtrcallArgs *p_ptrcall_args);
 	Array _get_signal_list() const;
 	Array _get_signal_connection_list(const String &p_signal) const;
 	Array _get_incoming_connections() const;
@@ -765,12 +794,13 @@ public:
 
 	template <typename... VarArgs>
 	Error emit_signal(const StringName &p_name, VarArgs... p_args) {
-		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return emit_signalp(p_name, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		// Arguments are only converted to Variants if a connected callable can't take them as they are.
+		const void *ptrargs[sizeof...(p_args) + 1] = { &p_args..., nullptr }; // +1 makes sure zero sized arrays are also supported.
+		SignalPtrcallArgs ptrcall_args;
+		ptrcall_args.signature = CallablePtrcallSignature<VarArgs...>::get();
+		ptrcall_args.args = ptrargs;
+		ptrcall_args.to_variants = &_ptrcall_args_to_variants<VarArgs...>;
+		return _emit_signalp(p_name, nullptr, sizeof...(p_args), &ptrcall_args);
 	}
 
 	Error emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount);
@@ -835,7 +865,7 @@ public:
 };
 
 bool predelete_handler(Object *p_object);
-void postinitialize_handler(Object *p_object);
+void postinitialize_handler(Object *p_object, const char *p_file, int p_line, size_t p_size);
 
 class ObjectDB {
 // This needs to add up to 63, 1 bit is for reference.
@@ -845,18 +875,39 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
-	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+// Slots live in fixed-size pages which never move, so lookups can read them without locking.
+#define OBJECTDB_SLOT_PAGE_BITS 12
+#define OBJECTDB_SLOT_PAGE_SIZE (1 << OBJECTDB_SLOT_PAGE_BITS)
+#define OBJECTDB_SLOT_PAGE_MASK (OBJECTDB_SLOT_PAGE_SIZE - 1)
+#define OBJECTDB_MAX_SLOT_PAGES (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_PAGE_BITS))
+
+	struct ObjectSlot {
+		// Zero while the slot is free. Slots are only reused with a new validator,
+		// which is what makes reading them without a lock safe.
+		std::atomic<uint64_t> validator;
+		std::atomic<Object *> object;
+		uint32_t next_free;
+		bool is_ref_counted;
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
+	static SpinLock spin_lock; // Only taken to allocate pages and to share free slots between threads.
+	static SafeNumeric<uint32_t> slot_count;
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static std::atomic<ObjectSlot *> slot_pages[OBJECTDB_MAX_SLOT_PAGES];
+	static uint32_t free_slots; // Shared list, threads grab and return batches of free slots.
+	static uint32_t free_slot_count;
+	static SafeNumeric<uint64_t> validator_counter;
+
+	struct ThreadFreeSlots;
+	static thread_local ThreadFreeSlots thread_free_slots;
+
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_pages[p_slot >> OBJECTDB_SLOT_PAGE_BITS].load(std::memory_order_relaxed)[p_slot & OBJECTDB_SLOT_PAGE_MASK];
+	}
+
+	static uint32_t _alloc_slot();
+	static void _free_slot(uint32_t p_slot);
+	static void _release_free_slots(uint32_t p_head, uint32_t p_count);
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -875,20 +926,25 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ObjectSlot *page = slot_pages[slot >> OBJECTDB_SLOT_PAGE_BITS].load(std::memory_order_acquire);
+		if (unlikely(page == nullptr)) {
+			ERR_FAIL_COND_V(id != 0, nullptr); // This should never happen unless the ID is corrupted.
+			return nullptr;
+		}
 
+		ObjectSlot &object_slot = page[slot & OBJECTDB_SLOT_PAGE_MASK];
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused while reading it, in which case the validator changed.
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
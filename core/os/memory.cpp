@@ -31,10 +31,12 @@
 #include "memory.h"
 
 #include "core/error/error_macros.h"
+#include "core/os/small_object_allocator.h"
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -63,7 +65,52 @@ SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
 #endif
 
-SafeNumeric<uint64_t> Memory::alloc_count;
+thread_local bool Memory::thread_alloc_tracking = false;
+thread_local uint64_t Memory::thread_alloc_count = 0;
+
+static _FORCE_INLINE_ void *_alloc_raw(size_t p_bytes) {
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+	if (p_bytes <= SmallObjectAllocator::MAX_SIZE) {
+		void *mem = SmallObjectAllocator::alloc(p_bytes);
+		if (mem) {
+			return mem;
+		}
+	}
+#endif
+	return malloc(p_bytes);
+}
+
+static _FORCE_INLINE_ void _free_raw(void *p_mem) {
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+	if (SmallObjectAllocator::free(p_mem)) {
+		return;
+	}
+#endif
+	free(p_mem);
+}
+
+static void *_realloc_raw(void *p_mem, size_t p_bytes) {
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+	size_t block_size = SmallObjectAllocator::get_block_size(p_mem);
+	if (block_size) {
+		if (p_bytes == 0) {
+			SmallObjectAllocator::free(p_mem);
+			return nullptr;
+		}
+		if (p_bytes <= block_size && p_bytes * 2 > block_size) {
+			return p_mem; // Still a good fit for its size class.
+		}
+		void *mem = _alloc_raw(p_bytes);
+		if (!mem) {
+			return nullptr;
+		}
+		memcpy(mem, p_mem, MIN(p_bytes, block_size));
+		SmallObjectAllocator::free(p_mem);
+		return mem;
+	}
+#endif
+	return realloc(p_mem, p_bytes);
+}
 
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
@@ -72,11 +119,13 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = malloc(p_bytes + (prepad ? PAD_ALIGN : 0));
+	void *mem = _alloc_raw(p_bytes + (prepad ? PAD_ALIGN : 0));
 
 	ERR_FAIL_COND_V(!mem, nullptr);
 
-	alloc_count.increment();
+	if (unlikely(thread_alloc_tracking)) {
+		thread_alloc_count++;
+	}
 
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
@@ -121,12 +170,16 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			_free_raw(mem);
 			return nullptr;
 		} else {
+			if (unlikely(thread_alloc_tracking) && p_bytes > *s) {
+				thread_alloc_count++;
+			}
+
 			*s = p_bytes;
 
-			mem = (uint8_t *)realloc(mem, p_bytes + PAD_ALIGN);
+			mem = (uint8_t *)_realloc_raw(mem, p_bytes + PAD_ALIGN);
 			ERR_FAIL_COND_V(!mem, nullptr);
 
 			s = (uint64_t *)mem;
@@ -136,10 +189,15 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			return mem + PAD_ALIGN;
 		}
 	} else {
-		mem = (uint8_t *)realloc(mem, p_bytes);
+		mem = (uint8_t *)_realloc_raw(mem, p_bytes);
 
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 
+		// The old size isn't stored here, so count it whenever the block had to move.
+		if (unlikely(thread_alloc_tracking) && mem != p_memory && mem != nullptr) {
+			thread_alloc_count++;
+		}
+
 		return mem;
 	}
 }
@@ -155,8 +213,6 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	alloc_count.decrement();
-
 	if (prepad) {
 		mem -= PAD_ALIGN;
 
@@ -165,9 +221,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 		mem_usage.sub(*s);
 #endif
 
-		free(mem);
+		_free_raw(mem);
 	} else {
-		free(mem);
+		_free_raw(mem);
 	}
 }
 
@@ -191,6 +247,18 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+void Memory::set_thread_alloc_tracking_enabled(bool p_enabled) {
+	thread_alloc_tracking = p_enabled;
+}
+
+bool Memory::is_thread_alloc_tracking_enabled() {
+	return thread_alloc_tracking;
+}
+
+uint64_t Memory::get_thread_alloc_count() {
+	return thread_alloc_count;
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -47,7 +47,9 @@ class Memory {
 	static SafeNumeric<uint64_t> max_usage;
 #endif
 
-	static SafeNumeric<uint64_t> alloc_count;
+	// Allocation counting is opt-in and per thread, so the common path stays free of atomics.
+	static thread_local bool thread_alloc_tracking;
+	static thread_local uint64_t thread_alloc_count;
 
 public:
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
@@ -57,11 +59,17 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static void set_thread_alloc_tracking_enabled(bool p_enabled);
+	static bool is_thread_alloc_tracking_enabled();
+	// Allocations made by the calling thread while tracking was enabled for it.
+	static uint64_t get_thread_alloc_count();
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
@@ -82,15 +90,20 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #define memrealloc(m_mem, m_size) Memory::realloc_static(m_mem, m_size)
 #define memfree(m_mem) Memory::free_static(m_mem)
 
-_ALWAYS_INLINE_ void postinitialize_handler(void *) {}
+_ALWAYS_INLINE_ void postinitialize_handler(void *, const char *, int, size_t) {}
 
 template <class T>
-_ALWAYS_INLINE_ T *_post_initialize(T *p_obj) {
-	postinitialize_handler(p_obj);
+_ALWAYS_INLINE_ T *_post_initialize(T *p_obj, const char *p_file = nullptr, int p_line = 0) {
+	postinitialize_handler(p_obj, p_file, p_line, sizeof(T));
 	return p_obj;
 }
 
+#ifdef DEBUG_ENABLED
+// Objects remember where they were created, for LeakProfiler.
+#define memnew(m_class) _post_initialize(new ("") m_class, __FILE__, __LINE__)
+#else
 #define memnew(m_class) _post_initialize(new ("") m_class)
+#endif
 
 #define memnew_allocator(m_class, m_allocator) _post_initialize(new (m_allocator::alloc) m_class)
 #define memnew_placement(m_placement, m_class) _post_initialize(new (m_placement) m_class)
@@ -0,0 +1,391 @@
+/*************************************************************************/
+/*  small_object_allocator.cpp                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "small_object_allocator.h"
+
+#include "core/os/spin_lock.h"
+
+#include <stdlib.h>
+#include <atomic>
+
+// Nothing in here may use constructors which run at static initialization
+// time: memory is allocated before (and after) any of those run.
+
+#define SPAN_SHIFT 16
+#define SPAN_SIZE (1 << SPAN_SHIFT)
+#define SPANS_PER_CHUNK 16
+#define SPAN_HEADER_SIZE 64
+#define SIZE_CLASS_COUNT 20
+
+// Open addressing table of span addresses, used to tell whether a pointer belongs to a span.
+// Kept at most half full, which caps small object memory at 1 GiB. Past that, Memory falls back to malloc.
+#define DIRECTORY_BITS 15
+#define DIRECTORY_SIZE (1 << DIRECTORY_BITS)
+#define MAX_SPANS (DIRECTORY_SIZE / 2)
+
+static const uint32_t size_class_block_sizes[SIZE_CLASS_COUNT] = {
+	16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512, 640, 768, 896, 1024
+};
+
+// Indexed by (size + 15) / 16.
+static const uint8_t size_class_lookup[(SmallObjectAllocator::MAX_SIZE / 16) + 1] = {
+	0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+	16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19
+};
+
+// Number of blocks moved between a thread cache and the central lists at once.
+static _FORCE_INLINE_ uint32_t _get_batch_size(uint32_t p_size_class) {
+	uint32_t batch = 8192 / size_class_block_sizes[p_size_class];
+	return CLAMP(batch, 4u, 64u);
+}
+
+struct Span {
+	Span *next;
+	Span *prev;
+	void *free_list;
+	uint8_t *bump; // Start of the never used part of the span.
+	uint32_t size_class;
+	uint32_t block_size;
+	uint32_t allocated; // Blocks handed out to threads, including those sitting in thread caches.
+	bool listed; // Whether it's in the central list of its size class (it has free blocks).
+};
+
+static_assert(sizeof(Span) <= SPAN_HEADER_SIZE, "Span header does not fit in the space reserved for it.");
+
+static _FORCE_INLINE_ Span *_get_span(const void *p_ptr) {
+	return (Span *)((uintptr_t)p_ptr & ~(uintptr_t)(SPAN_SIZE - 1));
+}
+
+static _FORCE_INLINE_ uint8_t *_get_span_end(Span *p_span) {
+	return (uint8_t *)p_span + SPAN_SIZE;
+}
+
+struct CentralList {
+	SpinLock lock;
+	Span *spans = nullptr;
+};
+
+static CentralList central_lists[SIZE_CLASS_COUNT];
+
+static SpinLock span_pool_lock;
+static Span *free_spans = nullptr;
+static uint32_t span_count = 0;
+static uint32_t free_span_count = 0;
+
+static std::atomic<uintptr_t> span_directory[DIRECTORY_SIZE];
+
+static _FORCE_INLINE_ uint32_t _directory_hash(uintptr_t p_key) {
+	return (uint32_t)(((uint64_t)p_key * 0x9E3779B97F4A7C15ULL) >> (64 - DIRECTORY_BITS));
+}
+
+static _FORCE_INLINE_ bool _directory_has(const void *p_ptr) {
+	uintptr_t key = (uintptr_t)p_ptr >> SPAN_SHIFT;
+	uint32_t idx = _directory_hash(key);
+	while (true) {
+		uintptr_t entry = span_directory[idx].load(std::memory_order_acquire);
+		// Checked first, as a null key (pointers in the first span) would match empty slots.
+		if (entry == 0) {
+			return false;
+		}
+		if (entry == key) {
+			return true;
+		}
+		idx = (idx + 1) & (DIRECTORY_SIZE - 1);
+	}
+}
+
+// Entries are never removed, so lookups need no lock. Must be called with span_pool_lock held.
+static void _directory_insert(Span *p_span) {
+	uintptr_t key = (uintptr_t)p_span >> SPAN_SHIFT;
+	uint32_t idx = _directory_hash(key);
+	while (span_directory[idx].load(std::memory_order_relaxed) != 0) {
+		idx = (idx + 1) & (DIRECTORY_SIZE - 1);
+	}
+	span_directory[idx].store(key, std::memory_order_release);
+}
+
+static Span *_span_acquire(uint32_t p_size_class) {
+	span_pool_lock.lock();
+
+	if (!free_spans) {
+		if (span_count + SPANS_PER_CHUNK > MAX_SPANS) {
+			span_pool_lock.unlock();
+			return nullptr;
+		}
+		// Chunks are never given back, their spans are recycled through the pool instead.
+		uint8_t *chunk = (uint8_t *)malloc(SPAN_SIZE * (SPANS_PER_CHUNK + 1));
+		if (!chunk) {
+			span_pool_lock.unlock();
+			return nullptr;
+		}
+		chunk = (uint8_t *)(((uintptr_t)chunk + SPAN_SIZE - 1) & ~(uintptr_t)(SPAN_SIZE - 1));
+		for (int i = SPANS_PER_CHUNK - 1; i >= 0; i--) {
+			Span *span = (Span *)(chunk + i * SPAN_SIZE);
+			_directory_insert(span);
+			span->next = free_spans;
+			free_spans = span;
+		}
+		span_count += SPANS_PER_CHUNK;
+		free_span_count += SPANS_PER_CHUNK;
+	}
+
+	Span *span = free_spans;
+	free_spans = span->next;
+	free_span_count--;
+
+	span_pool_lock.unlock();
+
+	span->next = nullptr;
+	span->prev = nullptr;
+	span->free_list = nullptr;
+	span->bump = (uint8_t *)span + SPAN_HEADER_SIZE;
+	span->size_class = p_size_class;
+	span->block_size = size_class_block_sizes[p_size_class];
+	span->allocated = 0;
+	span->listed = false;
+	return span;
+}
+
+static void _span_release(Span *p_span) {
+	span_pool_lock.lock();
+	p_span->next = free_spans;
+	free_spans = p_span;
+	free_span_count++;
+	span_pool_lock.unlock();
+}
+
+// The functions below must be called with the lock of the central list held.
+
+static _FORCE_INLINE_ void _central_link(CentralList &p_list, Span *p_span) {
+	p_span->prev = nullptr;
+	p_span->next = p_list.spans;
+	if (p_list.spans) {
+		p_list.spans->prev = p_span;
+	}
+	p_list.spans = p_span;
+	p_span->listed = true;
+}
+
+static _FORCE_INLINE_ void _central_unlink(CentralList &p_list, Span *p_span) {
+	if (p_span->prev) {
+		p_span->prev->next = p_span->next;
+	} else {
+		p_list.spans = p_span->next;
+	}
+	if (p_span->next) {
+		p_span->next->prev = p_span->prev;
+	}
+	p_span->next = nullptr;
+	p_span->prev = nullptr;
+	p_span->listed = false;
+}
+
+// Takes up to p_max blocks, linked through their first word. Returns how many were taken.
+static uint32_t _central_fetch(uint32_t p_size_class, void **r_head, uint32_t p_max) {
+	CentralList &list = central_lists[p_size_class];
+	void *head = nullptr;
+	uint32_t count = 0;
+
+	list.lock.lock();
+
+	while (count < p_max) {
+		Span *span = list.spans;
+		if (!span) {
+			span = _span_acquire(p_size_class);
+			if (!span) {
+				break;
+			}
+			_central_link(list, span);
+		}
+
+		while (count < p_max && span->free_list) {
+			void *block = span->free_list;
+			span->free_list = *(void **)block;
+			*(void **)block = head;
+			head = block;
+			span->allocated++;
+			count++;
+		}
+
+		uint8_t *end = _get_span_end(span);
+		while (count < p_max && span->bump + span->block_size <= end) {
+			void *block = span->bump;
+			span->bump += span->block_size;
+			*(void **)block = head;
+			head = block;
+			span->allocated++;
+			count++;
+		}
+
+		if (!span->free_list && span->bump + span->block_size > end) {
+			_central_unlink(list, span); // Full, will be listed again once a block comes back.
+		}
+	}
+
+	list.lock.unlock();
+
+	*r_head = head;
+	return count;
+}
+
+static void _central_release(uint32_t p_size_class, void *p_head) {
+	CentralList &list = central_lists[p_size_class];
+
+	list.lock.lock();
+
+	while (p_head) {
+		void *block = p_head;
+		p_head = *(void **)block;
+
+		Span *span = _get_span(block);
+		*(void **)block = span->free_list;
+		span->free_list = block;
+		span->allocated--;
+
+		if (!span->listed) {
+			_central_link(list, span);
+		}
+
+		// Keep a single empty span around per size class to avoid thrashing the pool.
+		if (span->allocated == 0 && (span->prev || span->next)) {
+			_central_unlink(list, span);
+			_span_release(span);
+		}
+	}
+
+	list.lock.unlock();
+}
+
+struct ThreadCache {
+	struct Bin {
+		void *head;
+		uint32_t count;
+	};
+
+	Bin bins[SIZE_CLASS_COUNT];
+	bool destroyed;
+
+	// Blocks must not stay stranded in the cache of a thread which is gone.
+	~ThreadCache() {
+		for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+			if (bins[i].head) {
+				_central_release(i, bins[i].head);
+				bins[i].head = nullptr;
+				bins[i].count = 0;
+			}
+		}
+		// Other thread-local destructors may still free memory after this one ran.
+		destroyed = true;
+	}
+};
+
+static thread_local ThreadCache thread_cache;
+
+void *SmallObjectAllocator::alloc(size_t p_bytes) {
+	if (p_bytes > MAX_SIZE) {
+		return nullptr;
+	}
+
+	uint32_t size_class = size_class_lookup[(p_bytes + 15) >> 4];
+	ThreadCache::Bin &bin = thread_cache.bins[size_class];
+
+	if (likely(bin.head)) {
+		void *block = bin.head;
+		bin.head = *(void **)block;
+		bin.count--;
+		return block;
+	}
+
+	void *head = nullptr;
+	uint32_t count = _central_fetch(size_class, &head, thread_cache.destroyed ? 1 : _get_batch_size(size_class));
+	if (count == 0) {
+		return nullptr;
+	}
+
+	bin.head = *(void **)head;
+	bin.count = count - 1;
+	return head;
+}
+
+bool SmallObjectAllocator::free(void *p_ptr) {
+	if (!_directory_has(p_ptr)) {
+		return false;
+	}
+
+	uint32_t size_class = _get_span(p_ptr)->size_class;
+
+	if (unlikely(thread_cache.destroyed)) {
+		*(void **)p_ptr = nullptr;
+		_central_release(size_class, p_ptr);
+		return true;
+	}
+
+	ThreadCache::Bin &bin = thread_cache.bins[size_class];
+	*(void **)p_ptr = bin.head;
+	bin.head = p_ptr;
+	bin.count++;
+
+	uint32_t batch = _get_batch_size(size_class);
+	if (unlikely(bin.count > batch * 2)) {
+		// Keep the most recently freed batch, which is likely still in cache, and give the rest back.
+		// Blocks freed here may have been allocated by other threads.
+		void *last_kept = bin.head;
+		for (uint32_t i = 1; i < batch; i++) {
+			last_kept = *(void **)last_kept;
+		}
+		void *released = *(void **)last_kept;
+		*(void **)last_kept = nullptr;
+		bin.count = batch;
+		_central_release(size_class, released);
+	}
+
+	return true;
+}
+
+size_t SmallObjectAllocator::get_block_size(const void *p_ptr) {
+	if (!_directory_has(p_ptr)) {
+		return 0;
+	}
+	return _get_span(p_ptr)->block_size;
+}
+
+uint32_t SmallObjectAllocator::get_span_count() {
+	span_pool_lock.lock();
+	uint32_t count = span_count;
+	span_pool_lock.unlock();
+	return count;
+}
+
+uint32_t SmallObjectAllocator::get_free_span_count() {
+	span_pool_lock.lock();
+	uint32_t count = free_span_count;
+	span_pool_lock.unlock();
+	return count;
+}
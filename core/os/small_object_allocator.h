@@ -0,0 +1,64 @@
+/*************************************************************************/
+/*  small_object_allocator.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef SMALL_OBJECT_ALLOCATOR_H
+#define SMALL_OBJECT_ALLOCATOR_H
+
+#include "core/typedefs.h"
+
+// Sanitizers need to see every allocation go through malloc to be useful.
+#if !defined(SANITIZERS_ENABLED) && !defined(NO_SMALL_OBJECT_ALLOCATOR)
+#define SMALL_OBJECT_ALLOCATOR_ENABLED
+#endif
+
+// Size-class allocator used by Memory for small blocks.
+// Blocks are carved from 64 KiB spans, each span serving a single size class.
+// Every thread keeps a cache of free blocks per size class, refilled from and
+// returned to a central, per size class list in batches. Spans which become
+// completely free are handed back to a shared pool and can be reused by any
+// size class. Blocks may be freed from any thread.
+class SmallObjectAllocator {
+public:
+	enum {
+		MAX_SIZE = 1024,
+	};
+
+	// Returns nullptr if the request is larger than MAX_SIZE or the allocator ran out of spans.
+	static void *alloc(size_t p_bytes);
+	// Returns false if the pointer was not allocated by this allocator.
+	static bool free(void *p_ptr);
+	// Returns 0 if the pointer was not allocated by this allocator.
+	static size_t get_block_size(const void *p_ptr);
+
+	static uint32_t get_span_count();
+	static uint32_t get_free_span_count();
+};
+
+#endif // SMALL_OBJECT_ALLOCATOR_H
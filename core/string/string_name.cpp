@@ -154,7 +154,10 @@ bool StringName::operator==(const String &p_name) const {
 		return (p_name.length() == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	if (_data->cname) {
+		return p_name == _data->cname; // Avoid building a String out of it.
+	}
+	return (_data->name == p_name);
 }
 
 bool StringName::operator==(const char *p_name) const {
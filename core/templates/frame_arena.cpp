@@ -0,0 +1,109 @@
+/*************************************************************************/
+/*  frame_arena.cpp                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "frame_arena.h"
+
+#include <string.h>
+
+thread_local FrameArena *FrameArena::current = nullptr;
+
+void FrameArena::_add_chunk(uint64_t p_min_size) {
+	// Grow geometrically, so a frame needing a lot of memory settles quickly.
+	uint64_t size = MAX(MAX(p_min_size, chunk_size), capacity);
+
+	Chunk *chunk = (Chunk *)memalloc(CHUNK_HEADER_SIZE + size);
+	CRASH_COND_MSG(!chunk, "Out of memory");
+	chunk->next = chunks;
+	chunk->size = size;
+	chunk->used = 0;
+
+	chunks = chunk;
+	capacity += size;
+	chunk_allocation_count++;
+}
+
+void FrameArena::_free_chunks() {
+	while (chunks) {
+		Chunk *next = chunks->next;
+		memfree(chunks);
+		chunks = next;
+	}
+	capacity = 0;
+}
+
+void *FrameArena::realloc(void *p_ptr, size_t p_bytes) {
+	if (p_ptr == nullptr) {
+		return alloc(p_bytes);
+	}
+
+	uint8_t *mem = (uint8_t *)p_ptr - HEADER_SIZE;
+	uint64_t old_bytes = *(uint64_t *)mem;
+	uint64_t old_size = HEADER_SIZE + ((old_bytes + ALIGN - 1) & ~(uint64_t)(ALIGN - 1));
+	uint64_t new_size = HEADER_SIZE + ((p_bytes + ALIGN - 1) & ~(uint64_t)(ALIGN - 1));
+
+	// The last allocation can be resized in place.
+	uint8_t *chunk_data = _get_chunk_data(chunks);
+	if (mem + old_size == chunk_data + chunks->used && chunks->used - old_size + new_size <= chunks->size) {
+		chunks->used = chunks->used - old_size + new_size;
+		used = used - old_size + new_size;
+		*(uint64_t *)mem = p_bytes;
+		return p_ptr;
+	}
+
+	if (p_bytes <= old_bytes) {
+		*(uint64_t *)mem = p_bytes;
+		return p_ptr;
+	}
+
+	void *new_mem = alloc(p_bytes);
+	memcpy(new_mem, p_ptr, old_bytes);
+	return new_mem;
+}
+
+void FrameArena::reset() {
+	if (chunks && chunks->next) {
+		// Outgrew the first chunk, replace all of them with one big enough for a whole frame.
+		uint64_t size = capacity;
+		_free_chunks();
+		_add_chunk(size);
+	} else if (chunks) {
+		chunks->used = 0;
+	}
+	used = 0;
+	allocation_count = 0;
+}
+
+FrameArena::FrameArena(uint64_t p_chunk_size) {
+	chunk_size = p_chunk_size;
+}
+
+FrameArena::~FrameArena() {
+	_free_chunks();
+}
@@ -0,0 +1,155 @@
+/*************************************************************************/
+/*  frame_arena.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+#include "core/typedefs.h"
+
+/**
+ * Bump allocator for temporaries which live for a single frame.
+ *
+ * Individual allocations are never freed, everything is released at once by
+ * reset(). Once the arena has grown to what a frame needs, it is backed by a
+ * single chunk and both allocating and resetting stop touching the heap.
+ *
+ * Containers can use it through FrameArenaAllocator (List, LocalVector) or
+ * FrameArenaTypedAllocator (HashMap elements). Those allocate from the arena
+ * made current on the calling thread with a FrameArena::Scope, and must be
+ * cleared or destroyed before the arena is reset.
+ */
+
+class FrameArena {
+	struct Chunk {
+		Chunk *next = nullptr;
+		uint64_t size = 0;
+		uint64_t used = 0;
+	};
+
+	enum {
+		ALIGN = 16,
+		HEADER_SIZE = 16, // Each allocation keeps its size in front of it, so it can be reallocated.
+		CHUNK_HEADER_SIZE = (sizeof(Chunk) + ALIGN - 1) & ~(ALIGN - 1),
+	};
+
+	Chunk *chunks = nullptr; // The first one is where allocations happen.
+	uint64_t capacity = 0;
+	uint64_t used = 0;
+	uint64_t chunk_size;
+	uint32_t allocation_count = 0;
+	uint32_t chunk_allocation_count = 0;
+
+	static thread_local FrameArena *current;
+
+	_FORCE_INLINE_ static uint8_t *_get_chunk_data(Chunk *p_chunk) {
+		return (uint8_t *)p_chunk + CHUNK_HEADER_SIZE;
+	}
+
+	void _add_chunk(uint64_t p_min_size);
+	void _free_chunks();
+
+public:
+	class Scope {
+		FrameArena *previous;
+
+	public:
+		_FORCE_INLINE_ explicit Scope(FrameArena *p_arena) {
+			previous = current;
+			current = p_arena;
+		}
+		_FORCE_INLINE_ ~Scope() {
+			current = previous;
+		}
+	};
+
+	_FORCE_INLINE_ static FrameArena *get_current() { return current; }
+
+	_FORCE_INLINE_ void *alloc(size_t p_bytes) {
+		uint64_t size = HEADER_SIZE + ((p_bytes + ALIGN - 1) & ~(uint64_t)(ALIGN - 1));
+		if (unlikely(!chunks || chunks->used + size > chunks->size)) {
+			_add_chunk(size);
+		}
+
+		uint8_t *mem = _get_chunk_data(chunks) + chunks->used;
+		*(uint64_t *)mem = p_bytes;
+		chunks->used += size;
+		used += size;
+		allocation_count++;
+		return mem + HEADER_SIZE;
+	}
+
+	void *realloc(void *p_ptr, size_t p_bytes);
+
+	// Releases every allocation made since the last reset.
+	void reset();
+
+	_FORCE_INLINE_ uint64_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint64_t get_used() const { return used; }
+	// Allocations made since the last reset.
+	_FORCE_INLINE_ uint32_t get_allocation_count() const { return allocation_count; }
+	// Times the arena had to go to the heap for a new chunk, since it was created.
+	_FORCE_INLINE_ uint32_t get_chunk_allocation_count() const { return chunk_allocation_count; }
+
+	explicit FrameArena(uint64_t p_chunk_size = 64 * 1024);
+	~FrameArena();
+};
+
+// For List and LocalVector. Uses the arena current on the calling thread.
+class FrameArenaAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) {
+		FrameArena *arena = FrameArena::get_current();
+		CRASH_COND_MSG(!arena, "Allocating from a frame arena, but no arena is current on this thread.");
+		return arena->alloc(p_memory);
+	}
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) {
+		FrameArena *arena = FrameArena::get_current();
+		CRASH_COND_MSG(!arena, "Allocating from a frame arena, but no arena is current on this thread.");
+		return arena->realloc(p_ptr, p_memory);
+	}
+	_FORCE_INLINE_ static void free(void *p_ptr) {}
+};
+
+// For HashMap elements. Uses the arena current on the calling thread.
+template <class T>
+class FrameArenaTypedAllocator {
+public:
+	template <class... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(FrameArenaAllocator::alloc(sizeof(T)), T(p_args...)); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) {
+		if (!__has_trivial_destructor(T)) {
+			p_allocation->~T();
+		}
+	}
+};
+
+#endif // FRAME_ARENA_H
@@ -266,7 +266,19 @@ void Array::append_array(const Array &p_array) {
 
 Error Array::resize(int p_new_size) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, ERR_LOCKED, "Array is in read-only state.");
-	return _p->array.resize(p_new_size);
+	int old_size = _p->array.size();
+	Error err = _p->array.resize(p_new_size);
+
+	// Keep typed arrays homogeneous, so their elements can be used without checking their type.
+	Variant::Type type = _p->typed.type;
+	if (err == OK && p_new_size > old_size && type != Variant::NIL && type != Variant::OBJECT) {
+		Variant *w = _p->array.ptrw();
+		Callable::CallError ce;
+		for (int i = old_size; i < p_new_size; i++) {
+			Variant::construct(type, w[i], nullptr, 0, ce);
+		}
+	}
+	return err;
 }
 
 Error Array::insert(int p_pos, const Variant &p_value) {
@@ -656,6 +668,10 @@ const void *Array::id() const {
 	return _p;
 }
 
+int Array::get_reference_count() const {
+	return _p->refcount.get();
+}
+
 Array::Array(const Array &p_from, uint32_t p_type, const StringName &p_class_name, const Variant &p_script) {
 	_p = memnew(ArrayPrivate);
 	_p->refcount.init();
@@ -118,6 +118,7 @@ public:
 	Variant max() const;
 
 	const void *id() const;
+	int get_reference_count() const;
 
 	bool typed_assign(const Array &p_other);
 	void set_typed(uint32_t p_type, const StringName &p_class_name, const Variant &p_script);
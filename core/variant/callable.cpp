@@ -63,6 +63,18 @@ void Callable::call(const Variant **p_arguments, int p_argcount, Variant &r_retu
 	}
 }
 
+const void *Callable::get_ptrcall_signature() const {
+	if (is_custom()) {
+		return custom->get_ptrcall_signature();
+	}
+	return nullptr;
+}
+
+void Callable::ptrcall(const void **p_arguments) const {
+	ERR_FAIL_COND_MSG(!is_custom(), "Only custom callables support typed calls.");
+	custom->ptrcall(p_arguments);
+}
+
 void Callable::rpc(int p_id, const Variant **p_arguments, int p_argcount, CallError &r_call_error) const {
 	if (is_null()) {
 		r_call_error.error = CallError::CALL_ERROR_INSTANCE_IS_NULL;
@@ -321,6 +333,14 @@ void CallableCustom::rpc(int p_peer_id, const Variant **p_arguments, int p_argco
 	r_call_error.expected = 0;
 }
 
+const void *CallableCustom::get_ptrcall_signature() const {
+	return nullptr;
+}
+
+void CallableCustom::ptrcall(const void **p_arguments) const {
+	ERR_FAIL_MSG(vformat("Typed calls are not supported by CallableCustom \"%s\".", get_as_text()));
+}
+
 const Callable *CallableCustom::get_base_comparator() const {
 	return nullptr;
 }
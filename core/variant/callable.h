@@ -39,6 +39,17 @@ class Object;
 class Variant;
 class CallableCustom;
 
+// Identifies a list of C++ argument types for Callable::ptrcall(). Callers and callables
+// only use the typed path when their signatures are the same.
+// The tag is writable on purpose, so the linker can't fold the tags of different signatures into one.
+template <class... P>
+struct CallablePtrcallSignature {
+	static inline char tag = 0;
+	static const void *get() {
+		return &tag;
+	}
+};
+
 // This is an abstraction of things that can be called.
 // It is used for signals and other cases where efficient calling of functions
 // is required. It is designed for the standard case (object and method)
@@ -70,6 +81,11 @@ public:
 	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, CallError &r_call_error) const;
 	void call_deferred(const Variant **p_arguments, int p_argcount) const;
 
+	// Calls with C++ arguments instead of Variants, p_arguments point to values of the types in get_ptrcall_signature().
+	// The return value is discarded. Only custom callables can have a signature, nullptr means a typed call is not possible.
+	const void *get_ptrcall_signature() const;
+	void ptrcall(const void **p_arguments) const;
+
 	void rpc(int p_id, const Variant **p_arguments, int p_argcount, CallError &r_call_error) const;
 
 	_FORCE_INLINE_ bool is_null() const {
@@ -128,6 +144,8 @@ public:
 	virtual StringName get_method() const;
 	virtual ObjectID get_object() const = 0; //must always be able to provide an object
 	virtual void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const = 0;
+	virtual const void *get_ptrcall_signature() const;
+	virtual void ptrcall(const void **p_arguments) const;
 	virtual void rpc(int p_peer_id, const Variant **p_arguments, int p_argcount, Callable::CallError &r_call_error) const;
 	virtual const Callable *get_base_comparator() const;
 
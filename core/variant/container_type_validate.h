@@ -34,11 +34,28 @@
 #include "core/object/script_language.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 struct ContainerTypeValidate {
 	Variant::Type type = Variant::NIL;
 	StringName class_name;
 	Ref<Script> script;
 	const char *where = "container";
+	// Last object class found to inherit from class_name, containers are usually filled with objects of the same class.
+	// Stored as the interned StringName pointer, as the same container may be validated from several threads at once.
+	std::atomic<const void *> last_valid_class = { nullptr };
+
+	ContainerTypeValidate() {}
+	ContainerTypeValidate(const ContainerTypeValidate &p_from) {
+		*this = p_from;
+	}
+	void operator=(const ContainerTypeValidate &p_from) {
+		type = p_from.type;
+		class_name = p_from.class_name;
+		script = p_from.script;
+		where = p_from.where;
+		last_valid_class.store(p_from.last_valid_class.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
 
 	_FORCE_INLINE_ bool can_reference(const ContainerTypeValidate &p_type) const {
 		if (type == p_type.type) {
@@ -105,8 +122,9 @@ struct ContainerTypeValidate {
 		}
 
 		StringName obj_class = object->get_class_name();
-		if (obj_class != class_name) {
-			ERR_FAIL_COND_V_MSG(!ClassDB::is_parent_class(object->get_class_name(), class_name), false, "Attempted to " + String(p_operation) + " an object of type '" + object->get_class() + "' into a " + where + ", which does not inherit from '" + String(class_name) + "'.");
+		if (obj_class != class_name && obj_class.data_unique_pointer() != last_valid_class.load(std::memory_order_relaxed)) {
+			ERR_FAIL_COND_V_MSG(!ClassDB::is_parent_class(obj_class, class_name), false, "Attempted to " + String(p_operation) + " an object of type '" + object->get_class() + "' into a " + where + ", which does not inherit from '" + String(class_name) + "'.");
+			last_valid_class.store(obj_class.data_unique_pointer(), std::memory_order_relaxed);
 		}
 
 		if (script.is_null()) {
@@ -39,10 +39,46 @@
 #include "core/variant/type_info.h"
 #include "core/variant/variant_internal.h"
 
+// StringName keys are stored as String. Hashing and comparing them as they are
+// spares converting every StringName used for a lookup (as GDScript constants are) into a String.
+
+struct DictionaryKeyHasher {
+	static _FORCE_INLINE_ uint32_t hash(const Variant &p_variant) {
+		if (p_variant.get_type() == Variant::STRING_NAME) {
+			// Same as the hash of the equivalent String, except for the empty name.
+			const StringName *sn = VariantInternal::get_string_name(&p_variant);
+			return sn->data_unique_pointer() ? sn->hash() : String().hash();
+		}
+		return p_variant.hash();
+	}
+};
+
+struct DictionaryKeyComparator {
+	static _FORCE_INLINE_ bool compare(const Variant &p_lhs, const Variant &p_rhs) {
+		Variant::Type lhs_type = p_lhs.get_type();
+		Variant::Type rhs_type = p_rhs.get_type();
+
+		if (unlikely(lhs_type == Variant::STRING_NAME || rhs_type == Variant::STRING_NAME)) {
+			if (lhs_type == rhs_type) {
+				return *VariantInternal::get_string_name(&p_lhs) == *VariantInternal::get_string_name(&p_rhs); // Pointer comparison.
+			}
+			if (lhs_type == Variant::STRING) {
+				return *VariantInternal::get_string_name(&p_rhs) == *VariantInternal::get_string(&p_lhs);
+			}
+			if (rhs_type == Variant::STRING) {
+				return *VariantInternal::get_string_name(&p_lhs) == *VariantInternal::get_string(&p_rhs);
+			}
+			return false;
+		}
+
+		return p_lhs.hash_compare(p_rhs);
+	}
+};
+
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, VariantComparator> variant_map;
+	HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator> variant_map;
 };
 
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
@@ -81,42 +117,33 @@ Variant Dictionary::get_value_at_index(int p_index) const {
 
 Variant &Dictionary::operator[](const Variant &p_key) {
 	if (unlikely(_p->read_only)) {
-		if (p_key.get_type() == Variant::STRING_NAME) {
-			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			*_p->read_only = _p->variant_map[sn->operator String()];
-		} else {
-			*_p->read_only = _p->variant_map[p_key];
-		}
-
+		*_p->read_only = _get_or_insert(p_key);
 		return *_p->read_only;
 	} else {
-		if (p_key.get_type() == Variant::STRING_NAME) {
-			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			return _p->variant_map[sn->operator String()];
-		} else {
-			return _p->variant_map[p_key];
-		}
+		return _get_or_insert(p_key);
 	}
 }
 
 const Variant &Dictionary::operator[](const Variant &p_key) const {
+	return _get_or_insert(p_key);
+}
+
+Variant &Dictionary::_get_or_insert(const Variant &p_key) const {
 	if (p_key.get_type() == Variant::STRING_NAME) {
+		// Only convert when the key has to be inserted.
+		HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>::Iterator E = _p->variant_map.find(p_key);
+		if (E) {
+			return E->value;
+		}
 		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		return _p->variant_map[sn->operator String()];
+		return _p->variant_map.insert(sn->operator String(), Variant())->value;
 	} else {
 		return _p->variant_map[p_key];
 	}
 }
 
 const Variant *Dictionary::getptr(const Variant &p_key) const {
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstIterator E;
-
-	if (p_key.get_type() == Variant::STRING_NAME) {
-		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(sn->operator String());
-	} else {
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
-	}
+	HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>::ConstIterator E = ((const HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator> *)&_p->variant_map)->find(p_key);
 
 	if (!E) {
 		return nullptr;
@@ -125,14 +152,8 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 }
 
 Variant *Dictionary::getptr(const Variant &p_key) {
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E;
+	HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>::Iterator E = ((HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator> *)&_p->variant_map)->find(p_key);
 
-	if (p_key.get_type() == Variant::STRING_NAME) {
-		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		E = ((HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(sn->operator String());
-	} else {
-		E = ((HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
-	}
 	if (!E) {
 		return nullptr;
 	}
@@ -145,14 +166,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 }
 
 Variant Dictionary::get_valid(const Variant &p_key) const {
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstIterator E;
-
-	if (p_key.get_type() == Variant::STRING_NAME) {
-		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(sn->operator String());
-	} else {
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
-	}
+	HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>::ConstIterator E = ((const HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator> *)&_p->variant_map)->find(p_key);
 
 	if (!E) {
 		return Variant();
@@ -178,12 +192,7 @@ bool Dictionary::is_empty() const {
 }
 
 bool Dictionary::has(const Variant &p_key) const {
-	if (p_key.get_type() == Variant::STRING_NAME) {
-		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		return _p->variant_map.has(sn->operator String());
-	} else {
-		return _p->variant_map.has(p_key);
-	}
+	return _p->variant_map.has(p_key);
 }
 
 bool Dictionary::has_all(const Array &p_keys) const {
@@ -197,12 +206,7 @@ bool Dictionary::has_all(const Array &p_keys) const {
 
 bool Dictionary::erase(const Variant &p_key) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, false, "Dictionary is in read-only state.");
-	if (p_key.get_type() == Variant::STRING_NAME) {
-		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		return _p->variant_map.erase(sn->operator String());
-	} else {
-		return _p->variant_map.erase(p_key);
-	}
+	return _p->variant_map.erase(p_key);
 }
 
 bool Dictionary::operator==(const Dictionary &p_dictionary) const {
@@ -229,7 +233,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	}
 	recursion_count++;
 	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstIterator other_E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&p_dictionary._p->variant_map)->find(this_E.key);
+		HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>::ConstIterator other_E = ((const HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator> *)&p_dictionary._p->variant_map)->find(this_E.key);
 		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count)) {
 			return false;
 		}
@@ -343,7 +347,7 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 		}
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.find(*p_key);
+	HashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>::Iterator E = _p->variant_map.find(*p_key);
 
 	if (!E) {
 		return nullptr;
@@ -410,6 +414,10 @@ const void *Dictionary::id() const {
 	return _p;
 }
 
+int Dictionary::get_reference_count() const {
+	return _p->refcount.get();
+}
+
 Dictionary::Dictionary(const Dictionary &p_from) {
 	_p = nullptr;
 	_ref(p_from);
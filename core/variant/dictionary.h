@@ -44,6 +44,7 @@ class Dictionary {
 
 	void _ref(const Dictionary &p_from) const;
 	void _unref() const;
+	Variant &_get_or_insert(const Variant &p_key) const;
 
 public:
 	void get_key_list(List<Variant> *p_keys) const;
@@ -88,6 +89,7 @@ public:
 	bool is_read_only() const;
 
 	const void *id() const;
+	int get_reference_count() const;
 
 	Dictionary(const Dictionary &p_from);
 	Dictionary();
@@ -1494,6 +1494,9 @@ int MeshStorage::skeleton_get_bone_count(RID p_skeleton) const {
 void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) {
 }
 
+void MeshStorage::skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform3D> &p_transforms) {
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	return Transform3D();
 }
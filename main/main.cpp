@@ -594,6 +594,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	translation_server = memnew(TranslationServer);
 	performance = memnew(Performance);
 	GDREGISTER_CLASS(Performance);
+	// Feeds the per-frame allocation monitor. Only the main thread is counted.
+	Memory::set_thread_alloc_tracking_enabled(true);
 	engine->add_singleton(Engine::Singleton("Performance", performance));
 
 	// Only flush stdout in debug builds by default, as spamming `print()` will
@@ -2654,6 +2656,8 @@ bool Main::iteration() {
 
 	iterating++;
 
+	const uint64_t alloc_count_begin = Memory::get_thread_alloc_count();
+
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -2767,6 +2771,8 @@ bool Main::iteration() {
 
 	AudioServer::get_singleton()->update();
 
+	performance->set_frame_allocation_count(Memory::get_thread_alloc_count() - alloc_count_begin);
+
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
 	}
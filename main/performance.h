@@ -47,6 +47,7 @@ class Performance : public Object {
 
 	double _process_time;
 	double _physics_process_time;
+	uint64_t _frame_allocation_count = 0;
 
 	class MonitorCall {
 		Callable _callable;
@@ -87,6 +88,9 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		AUDIO_REAL_VOICES,
+		AUDIO_VIRTUAL_VOICES,
+		MEMORY_FRAME_ALLOCATIONS,
 		MONITOR_MAX
 	};
 
@@ -103,6 +107,7 @@ public:
 
 	void set_process_time(double p_pt);
 	void set_physics_process_time(double p_pt);
+	void set_frame_allocation_count(uint64_t p_count);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
@@ -40,6 +40,10 @@
 int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND_V(!active, 0);
 
+	if (seek_pending) {
+		_seek_internal(float(frames_mixed) / mp3_stream->sample_rate);
+	}
+
 	int todo = p_frames;
 
 	int frames_mixed_this_step = p_frames;
@@ -59,7 +63,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (mp3_stream->loop) {
-				seek(mp3_stream->loop_offset);
+				_seek_internal(mp3_stream->loop_offset);
 				loops++;
 			} else {
 				frames_mixed_this_step = p_frames - todo;
@@ -75,22 +79,69 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	return frames_mixed_this_step;
 }
 
+int AudioStreamPlaybackMP3::_skip_internal(int p_frames) {
+	if (!active) {
+		return 0;
+	}
+
+	const double sampling_rate = mp3_stream->sample_rate;
+	const int64_t length_frames = int64_t(mp3_stream->get_length() * sampling_rate);
+	if (length_frames <= 0) {
+		return -1;
+	}
+
+	int64_t position = int64_t(frames_mixed) + p_frames;
+	if (position >= length_frames) {
+		if (!mp3_stream->loop) {
+			active = false;
+			return p_frames - int(position - length_frames);
+		}
+		const int64_t loop_offset_frames = int64_t(mp3_stream->loop_offset * sampling_rate);
+		if (loop_offset_frames >= length_frames) {
+			return -1;
+		}
+		const int64_t loop_frames = length_frames - loop_offset_frames;
+		loops += int((position - length_frames) / loop_frames) + 1;
+		position = loop_offset_frames + (position - length_frames) % loop_frames;
+	}
+
+	frames_mixed = uint32_t(position);
+	seek_pending = true;
+	return p_frames;
+}
+
+bool AudioStreamPlaybackMP3::_can_skip_internal() const {
+	// Same conditions as in _skip_internal().
+	const double sampling_rate = mp3_stream->sample_rate;
+	const int64_t length_frames = int64_t(mp3_stream->get_length() * sampling_rate);
+	if (length_frames <= 0) {
+		return false;
+	}
+	return !mp3_stream->loop || int64_t(mp3_stream->loop_offset * sampling_rate) < length_frames;
+}
+
 float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 	return mp3_stream->sample_rate;
 }
 
 void AudioStreamPlaybackMP3::start(float p_from_pos) {
-	active = true;
-	seek(p_from_pos);
+	end_decode_ahead();
+	_seek_internal(p_from_pos);
 	loops = 0;
 	begin_resample();
+	begin_decode_ahead();
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	end_decode_ahead();
 	active = false;
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
+	if (is_decode_ahead_active()) {
+		// The decoder belongs to the decode-ahead thread, and may be done before its frames are mixed.
+		return !is_decode_ahead_drained();
+	}
 	return active;
 }
 
@@ -99,13 +150,26 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 float AudioStreamPlaybackMP3::get_playback_position() const {
-	return float(frames_mixed) / mp3_stream->sample_rate;
+	// Frames decoded ahead haven't been heard yet.
+	return float(MAX(int64_t(frames_mixed) - get_decode_ahead_frames(), 0)) / mp3_stream->sample_rate;
 }
 
 void AudioStreamPlaybackMP3::seek(float p_time) {
+	if (is_decode_ahead_active()) {
+		// The decoder belongs to the decode-ahead thread, it seeks before decoding its next chunk.
+		request_decode_ahead_seek(p_time);
+		return;
+	}
 	if (!active) {
 		return;
 	}
+	_seek_internal(p_time);
+}
+
+void AudioStreamPlaybackMP3::_seek_internal(float p_time) {
+	// Seeking restarts a decoder that reached the end.
+	active = true;
+	seek_pending = false;
 
 	if (p_time >= mp3_stream->get_length()) {
 		p_time = 0;
@@ -116,6 +180,7 @@ void AudioStreamPlaybackMP3::seek(float p_time) {
 }
 
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	end_decode_ahead();
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
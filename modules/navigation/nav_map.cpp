@@ -651,13 +651,20 @@ void NavMap::sync() {
 	}
 
 	// Update agents tree.
-	if (agents_dirty) {
+	// The tree is only rebuilt when the agent set changes or periodically to
+	// keep it balanced; in between, the node bounds are refit to the current
+	// agent positions, which is linear and doesn't reorder the agents.
+	if (agents_dirty || agents_tree_refit_count >= AGENTS_TREE_MAX_REFITS) {
 		std::vector<RVO::Agent *> raw_agents;
 		raw_agents.reserve(agents.size());
 		for (size_t i(0); i < agents.size(); i++) {
 			raw_agents.push_back(agents[i]->get_agent());
 		}
-		rvo.buildAgentTree(raw_agents);
+		rvo.buildAgentTree(std::move(raw_agents));
+		agents_tree_refit_count = 0;
+	} else {
+		rvo.refitAgentTree();
+		agents_tree_refit_count++;
 	}
 
 	regenerate_polygons = false;
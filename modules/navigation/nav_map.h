@@ -69,6 +69,10 @@ class NavMap : public NavRid {
 	/// Is agent array modified?
 	bool agents_dirty = false;
 
+	/// Number of syncs since the agents tree was last rebuilt.
+	static const uint32_t AGENTS_TREE_MAX_REFITS = 30;
+	uint32_t agents_tree_refit_count = 0;
+
 	/// All the Agents (even the controlled one)
 	std::vector<RvoAgent *> agents;
 
@@ -869,6 +869,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontTexturePosition TextServerAdvanced::find_
 
 		p_data->textures.push_back(tex);
 		ret.index = p_data->textures.size() - 1;
+		glyph_cache_pages_added.store(true);
 	}
 
 	return ret;
@@ -1262,7 +1263,9 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontDataAdvanced *p_font_d
 
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontDataAdvanced *p_font_data, const Vector2i &p_size) const {
 	ERR_FAIL_COND_V(p_size.x <= 0, false);
-	if (p_font_data->cache.has(p_size)) {
+	FontDataForSizeAdvanced *const *cached = p_font_data->cache.getptr(p_size);
+	if (cached) {
+		(*cached)->last_used = ++glyph_cache_tick;
 		return true;
 	}
 
@@ -1663,6 +1666,7 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontDataAdvanced
 		// Init bitmap font.
 		fd->hb_handle = _bmp_font_create(fd, nullptr);
 	}
+	fd->last_used = ++glyph_cache_tick;
 	p_font_data->cache[p_size] = fd;
 	return true;
 }
@@ -1672,6 +1676,7 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontDataAdvanced *p_fo
 		memdelete(E.value);
 	}
 	p_font_data->cache.clear();
+	p_font_data->shaping_version++;
 	p_font_data->face_init = false;
 	p_font_data->supported_features.clear();
 	p_font_data->supported_varaitions.clear();
@@ -2046,6 +2051,7 @@ void TextServerAdvanced::font_clear_size_cache(const RID &p_font_rid) {
 		memdelete(E.value);
 	}
 	fd->cache.clear();
+	fd->shaping_version++;
 }
 
 void TextServerAdvanced::font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
@@ -2056,6 +2062,7 @@ void TextServerAdvanced::font_remove_size_cache(const RID &p_font_rid, const Vec
 	if (fd->cache.has(p_size)) {
 		memdelete(fd->cache[p_size]);
 		fd->cache.erase(p_size);
+		fd->shaping_version++;
 	}
 }
 
@@ -4672,6 +4679,7 @@ bool TextServerAdvanced::shaped_text_update_justification_ops(const RID &p_shape
 }
 
 Glyph TextServerAdvanced::_shape_single_glyph(ShapedTextDataAdvanced *p_sd, char32_t p_char, hb_script_t p_script, hb_direction_t p_direction, const RID &p_font, int64_t p_font_size) {
+	std::shared_lock<std::shared_timed_mutex> read_lock(glyph_cache_lock);
 	hb_font_t *hb_font = _font_get_hb_handle(p_font, p_font_size);
 	bool subpos = (font_get_subpixel_positioning(p_font) == SUBPIXEL_POSITIONING_ONE_HALF) || (font_get_subpixel_positioning(p_font) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (font_get_subpixel_positioning(p_font) == SUBPIXEL_POSITIONING_AUTO && p_font_size <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
 	ERR_FAIL_COND_V(hb_font == nullptr, Glyph());
@@ -4726,6 +4734,198 @@ Glyph TextServerAdvanced::_shape_single_glyph(ShapedTextDataAdvanced *p_sd, char
 	return gl;
 }
 
+void TextServerAdvanced::ShapingCacheKey::update_hash() {
+	uint32_t h = text.hash();
+	h = hash_djb2_one_64(font_rid.get_id(), h);
+	h = hash_djb2_one_64(font_size, h);
+	h = hash_djb2_one_64(font_version, h);
+	h = hash_djb2_one_32(direction, h);
+	h = hash_djb2_one_32(script, h);
+	h = hash_djb2_one_32(flags, h);
+	h = hash_djb2_one_32(language.hash(), h);
+	for (int i = 0; i < features.size(); i++) {
+		h = hash_djb2_one_32(features[i], h);
+	}
+	h = hash_djb2_one_64(item_offset, h);
+	hash = hash_djb2_one_64(item_length, h);
+}
+
+bool TextServerAdvanced::ShapingCacheKey::operator==(const ShapingCacheKey &p_b) const {
+	return hash == p_b.hash && font_rid == p_b.font_rid && font_size == p_b.font_size && font_version == p_b.font_version && direction == p_b.direction && script == p_b.script && flags == p_b.flags && item_offset == p_b.item_offset && item_length == p_b.item_length && features == p_b.features && language == p_b.language && text == p_b.text;
+}
+
+bool TextServerAdvanced::_shaping_cache_get(const ShapingCacheKey &p_key, Vector<hb_glyph_info_t> &r_glyph_info, Vector<hb_glyph_position_t> &r_glyph_pos) {
+	MutexLock lock(shaping_cache_mutex);
+
+	List<ShapingCacheEntry>::Element **E = shaping_cache.getptr(p_key);
+	if (!E) {
+		shaping_cache_misses++;
+		return false;
+	}
+	shaping_cache_hits++;
+	shaping_cache_lru.move_to_front(*E);
+	r_glyph_info = (*E)->get().glyph_info;
+	r_glyph_pos = (*E)->get().glyph_pos;
+	return true;
+}
+
+void TextServerAdvanced::_shaping_cache_insert(const ShapingCacheKey &p_key, const hb_glyph_info_t *p_glyph_info, const hb_glyph_position_t *p_glyph_pos, unsigned int p_glyph_count, int64_t p_run_start) {
+	ShapingCacheEntry entry;
+	entry.key = p_key;
+	entry.glyph_info.resize(p_glyph_count);
+	entry.glyph_pos.resize(p_glyph_count);
+	hb_glyph_info_t *info_w = entry.glyph_info.ptrw();
+	hb_glyph_position_t *pos_w = entry.glyph_pos.ptrw();
+	for (unsigned int i = 0; i < p_glyph_count; i++) {
+		info_w[i] = p_glyph_info[i];
+		info_w[i].cluster -= p_run_start;
+		pos_w[i] = p_glyph_pos[i];
+	}
+	entry.memory = sizeof(ShapingCacheEntry) + (p_key.text.length() + p_key.language.length()) * sizeof(char32_t) + p_key.features.size() * sizeof(uint32_t) + p_glyph_count * (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t));
+
+	MutexLock lock(shaping_cache_mutex);
+	if (shaping_cache.has(p_key)) {
+		return; // Shaped by another thread in the meantime.
+	}
+	shaping_cache[p_key] = shaping_cache_lru.push_front(entry);
+	shaping_cache_memory += entry.memory;
+	_shaping_cache_trim();
+}
+
+void TextServerAdvanced::_shaping_cache_trim() {
+	while (shaping_cache_memory > shaping_cache_max_memory && shaping_cache_lru.back()) {
+		List<ShapingCacheEntry>::Element *E = shaping_cache_lru.back();
+		shaping_cache_memory -= E->get().memory;
+		shaping_cache.erase(E->get().key);
+		shaping_cache_lru.erase(E);
+		shaping_cache_evictions++;
+	}
+}
+
+void TextServerAdvanced::_glyph_cache_enforce_budget() {
+	if (glyph_cache_max_memory <= 0) {
+		return;
+	}
+
+	struct SizeCacheUsage {
+		RID font_rid;
+		Vector2i size;
+		uint64_t last_used = 0;
+		int64_t memory = 0;
+
+		bool operator<(const SizeCacheUsage &p_b) const {
+			return last_used < p_b.last_used;
+		}
+	};
+
+	Vector<RID> evicted_fonts;
+	{
+		_THREAD_SAFE_METHOD_
+
+		// Only dynamic fonts can be re-rasterized, the glyphs of bitmap fonts are never dropped.
+		Vector<SizeCacheUsage> usage;
+		int64_t total_memory = 0;
+		List<RID> fonts;
+		font_owner.get_owned_list(&fonts);
+		for (const RID &font_rid : fonts) {
+			FontDataAdvanced *fd = font_owner.get_or_null(font_rid);
+			MutexLock lock(fd->mutex);
+			bool evictable = fd->data_ptr && (fd->data_size > 0);
+			for (const KeyValue<Vector2i, FontDataForSizeAdvanced *> &E : fd->cache) {
+				SizeCacheUsage size_usage;
+				size_usage.font_rid = font_rid;
+				size_usage.size = E.key;
+				size_usage.last_used = E.value->last_used;
+				for (int i = 0; i < E.value->textures.size(); i++) {
+					size_usage.memory += E.value->textures[i].imgdata.size();
+				}
+				total_memory += size_usage.memory;
+				if (evictable) {
+					usage.push_back(size_usage);
+				}
+			}
+		}
+
+		if (total_memory > glyph_cache_max_memory) {
+			// Wait for the text being shaped on other threads to release the HarfBuzz fonts of the size caches.
+			std::unique_lock<std::shared_timed_mutex> write_lock(glyph_cache_lock);
+
+			usage.sort();
+			// Keep the most recently used size cache, it is most likely being drawn right now.
+			for (int i = 0; i < usage.size() - 1 && total_memory > glyph_cache_max_memory; i++) {
+				const SizeCacheUsage &size_usage = usage[i];
+				FontDataAdvanced *fd = font_owner.get_or_null(size_usage.font_rid);
+				MutexLock lock(fd->mutex);
+				FontDataForSizeAdvanced **E = fd->cache.getptr(size_usage.size);
+				if (!E || (*E)->last_used != size_usage.last_used) {
+					continue; // Used again in the meantime.
+				}
+				memdelete(*E);
+				fd->cache.erase(size_usage.size);
+				total_memory -= size_usage.memory;
+				glyph_cache_evictions++;
+				if (!evicted_fonts.has(size_usage.font_rid)) {
+					evicted_fonts.push_back(size_usage.font_rid);
+				}
+			}
+		}
+		glyph_cache_memory = total_memory;
+	}
+
+	// Text drawn before still references the freed glyph textures, its font users have to redraw it.
+	for (int i = 0; i < evicted_fonts.size(); i++) {
+		emit_signal("font_size_cache_evicted", evicted_fonts[i]);
+	}
+}
+
+void TextServerAdvanced::set_shaping_cache_max_memory(int64_t p_bytes) {
+	MutexLock lock(shaping_cache_mutex);
+	shaping_cache_max_memory = MAX(p_bytes, 0);
+	_shaping_cache_trim();
+}
+
+int64_t TextServerAdvanced::get_shaping_cache_max_memory() const {
+	return shaping_cache_max_memory;
+}
+
+void TextServerAdvanced::clear_shaping_cache() {
+	MutexLock lock(shaping_cache_mutex);
+	shaping_cache.clear();
+	shaping_cache_lru.clear();
+	shaping_cache_memory = 0;
+}
+
+void TextServerAdvanced::set_glyph_cache_max_memory(int64_t p_bytes) {
+	glyph_cache_max_memory = MAX(p_bytes, 0);
+	glyph_cache_pages_added.store(true);
+}
+
+int64_t TextServerAdvanced::get_glyph_cache_max_memory() const {
+	return glyph_cache_max_memory;
+}
+
+Dictionary TextServerAdvanced::get_cache_statistics() {
+	Dictionary stats;
+	{
+		MutexLock lock(shaping_cache_mutex);
+		stats["shaping_cache_entries"] = shaping_cache.size();
+		stats["shaping_cache_memory"] = shaping_cache_memory;
+		stats["shaping_cache_max_memory"] = shaping_cache_max_memory;
+		stats["shaping_cache_hits"] = shaping_cache_hits;
+		stats["shaping_cache_misses"] = shaping_cache_misses;
+		stats["shaping_cache_evictions"] = shaping_cache_evictions;
+		uint64_t lookups = shaping_cache_hits + shaping_cache_misses;
+		stats["shaping_cache_hit_rate"] = lookups > 0 ? double(shaping_cache_hits) / double(lookups) : 0.0;
+	}
+	{
+		_THREAD_SAFE_METHOD_
+		stats["glyph_cache_memory"] = glyph_cache_memory;
+		stats["glyph_cache_max_memory"] = glyph_cache_max_memory;
+		stats["glyph_cache_evictions"] = glyph_cache_evictions;
+	}
+	return stats;
+}
+
 _FORCE_INLINE_ void TextServerAdvanced::_add_featuers(const Dictionary &p_source, Vector<hb_feature_t> &r_ftrs) {
 	Array keys = p_source.keys();
 	Array values = p_source.values();
@@ -4781,39 +4981,90 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	RID f = p_fonts[p_fb_index];
 	FontDataAdvanced *fd = font_owner.get_or_null(f);
 	Vector2i fss = _get_size(fd, fs);
-	hb_font_t *hb_font = _font_get_hb_handle(f, fs);
 	double scale = font_get_scale(f, fs);
 	double sp_sp = font_get_spacing(f, fs, SPACING_SPACE);
 	double sp_gl = font_get_spacing(f, fs, SPACING_GLYPH);
 	double ea = _get_extra_advance(f, fs);
 	bool subpos = (font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
-	ERR_FAIL_COND(hb_font == nullptr);
 
-	hb_buffer_clear_contents(p_sd->hb_buffer);
-	hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
+	hb_buffer_flags_t flags;
 	if (p_sd->preserve_control) {
-		hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)(HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES | (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0)));
+		flags = (hb_buffer_flags_t)(HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES | (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0));
 	} else {
-		hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)(HB_BUFFER_FLAG_DEFAULT | (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0)));
+		flags = (hb_buffer_flags_t)(HB_BUFFER_FLAG_DEFAULT | (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0));
 	}
-	hb_buffer_set_script(p_sd->hb_buffer, p_script);
-
-	if (!p_sd->spans[p_span].language.is_empty()) {
-		hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
-	}
-
-	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
 
 	Vector<hb_feature_t> ftrs;
 	_add_featuers(font_get_opentype_feature_overrides(f), ftrs);
 	_add_featuers(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
-
 	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+	hb_glyph_info_t *glyph_info = nullptr;
+	hb_glyph_position_t *glyph_pos = nullptr;
+
+	// Reuse the glyphs of an identical run shaped before, if any.
+	ShapingCacheKey key;
+	Vector<hb_glyph_info_t> cached_glyph_info;
+	Vector<hb_glyph_position_t> cached_glyph_pos;
+	bool use_shaping_cache = shaping_cache_max_memory > 0;
+	if (use_shaping_cache) {
+		key.font_rid = f;
+		key.font_size = fs;
+		{
+			MutexLock lock(fd->mutex);
+			key.font_version = fd->shaping_version;
+		}
+		key.direction = p_direction;
+		key.script = p_script;
+		key.flags = flags;
+		key.language = p_sd->spans[p_span].language;
+		key.features.resize(ftrs.size() * 2);
+		for (int i = 0; i < ftrs.size(); i++) {
+			key.features.write[i * 2 + 0] = ftrs[i].tag;
+			key.features.write[i * 2 + 1] = ftrs[i].value;
+		}
+		int64_t context_start = MAX(0, p_start - SHAPING_CACHE_CONTEXT_LENGTH);
+		int64_t context_end = MIN(p_sd->text.length(), p_end + SHAPING_CACHE_CONTEXT_LENGTH);
+		key.text = p_sd->text.substr(context_start, context_end - context_start);
+		key.item_offset = p_start - context_start;
+		key.item_length = p_end - p_start;
+		key.update_hash();
+	}
+
+	if (use_shaping_cache && _shaping_cache_get(key, cached_glyph_info, cached_glyph_pos)) {
+		glyph_count = cached_glyph_info.size();
+		glyph_info = cached_glyph_info.ptrw();
+		glyph_pos = cached_glyph_pos.ptrw();
+		for (unsigned int i = 0; i < glyph_count; i++) {
+			glyph_info[i].cluster += p_start;
+		}
+	} else {
+		// Not held while shaping fallback runs below, which takes it again.
+		std::shared_lock<std::shared_timed_mutex> read_lock(glyph_cache_lock);
+		hb_font_t *hb_font = _font_get_hb_handle(f, fs);
+		ERR_FAIL_COND(hb_font == nullptr);
+
+		hb_buffer_clear_contents(p_sd->hb_buffer);
+		hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
+		hb_buffer_set_flags(p_sd->hb_buffer, flags);
+		hb_buffer_set_script(p_sd->hb_buffer, p_script);
+
+		if (!p_sd->spans[p_span].language.is_empty()) {
+			hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
+			hb_buffer_set_language(p_sd->hb_buffer, lang);
+		}
+
+		hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+
+		glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
+		glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+
+		if (use_shaping_cache) {
+			_shaping_cache_insert(key, glyph_info, glyph_pos, glyph_count, p_start);
+		}
+	}
 
 	// Process glyphs.
 	if (glyph_count > 0) {
@@ -4954,6 +5205,11 @@ bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_V(!sd, false);
 
+	// Evict from the main thread, where the users of the evicted fonts can redraw right away.
+	if (glyph_cache_max_memory > 0 && glyph_cache_pages_added.exchange(false)) {
+		call_deferred("_glyph_cache_enforce_budget");
+	}
+
 	MutexLock lock(sd->mutex);
 	if (sd->valid) {
 		return true;
@@ -5632,7 +5888,23 @@ PackedInt32Array TextServerAdvanced::string_get_word_breaks(const String &p_stri
 	return ret;
 }
 
+void TextServerAdvanced::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_shaping_cache_max_memory", "bytes"), &TextServerAdvanced::set_shaping_cache_max_memory);
+	ClassDB::bind_method(D_METHOD("get_shaping_cache_max_memory"), &TextServerAdvanced::get_shaping_cache_max_memory);
+	ClassDB::bind_method(D_METHOD("clear_shaping_cache"), &TextServerAdvanced::clear_shaping_cache);
+
+	ClassDB::bind_method(D_METHOD("set_glyph_cache_max_memory", "bytes"), &TextServerAdvanced::set_glyph_cache_max_memory);
+	ClassDB::bind_method(D_METHOD("get_glyph_cache_max_memory"), &TextServerAdvanced::get_glyph_cache_max_memory);
+
+	ClassDB::bind_method(D_METHOD("get_cache_statistics"), &TextServerAdvanced::get_cache_statistics);
+
+	ClassDB::bind_method(D_METHOD("_glyph_cache_enforce_budget"), &TextServerAdvanced::_glyph_cache_enforce_budget);
+}
+
 TextServerAdvanced::TextServerAdvanced() {
+	glyph_cache_tick.store(0);
+	glyph_cache_pages_added.store(false);
+
 	_insert_num_systems_lang();
 	_insert_feature_sets();
 	_bmp_create_font_funcs();
@@ -89,6 +89,9 @@ using namespace godot;
 
 #include "script_iterator.h"
 
+#include <atomic>
+#include <shared_mutex>
+
 // Thirdparty headers.
 
 #include <unicode/ubidi.h>
@@ -194,6 +197,8 @@ class TextServerAdvanced : public TextServerExtension {
 		HashMap<Vector2i, Vector2, VariantHasher, VariantComparator> kerning_map;
 		hb_font_t *hb_handle = nullptr;
 
+		uint64_t last_used = 0; // Glyph cache tick of the last access, used for the texture budget.
+
 #ifdef MODULE_FREETYPE_ENABLED
 		FT_Face face = nullptr;
 		FT_StreamRec stream;
@@ -233,6 +238,7 @@ class TextServerAdvanced : public TextServerExtension {
 		String style_name;
 
 		HashMap<Vector2i, FontDataForSizeAdvanced *, VariantHasher, VariantComparator> cache;
+		uint64_t shaping_version = 0; // Incremented when the font data changes, invalidates the shaping cache entries of this font.
 
 		bool face_init = false;
 		HashSet<uint32_t> supported_scripts;
@@ -292,6 +298,17 @@ class TextServerAdvanced : public TextServerExtension {
 
 	_FORCE_INLINE_ double _get_extra_advance(RID p_font_rid, int p_font_size) const;
 
+	// Glyph texture budget, least recently used size caches of dynamic fonts are dropped and re-rasterized on demand.
+	int64_t glyph_cache_max_memory = 0; // In bytes, 0 is unlimited.
+	int64_t glyph_cache_memory = 0;
+	uint64_t glyph_cache_evictions = 0;
+	mutable std::atomic<uint64_t> glyph_cache_tick;
+	mutable std::atomic<bool> glyph_cache_pages_added;
+	// Held for reading while a HarfBuzz font of a size cache is in use, and for writing to evict size caches.
+	mutable std::shared_timed_mutex glyph_cache_lock;
+
+	void _glyph_cache_enforce_budget();
+
 	// Shaped text cache data.
 	struct TrimData {
 		int trim_pos = -1;
@@ -385,6 +402,51 @@ class TextServerAdvanced : public TextServerExtension {
 		}
 	};
 
+	// Shaping cache, shared by all shaped texts and keyed by the HarfBuzz input of a run.
+	static const int SHAPING_CACHE_CONTEXT_LENGTH = 5; // HarfBuzz looks at up to 5 characters around a run.
+
+	struct ShapingCacheKey {
+		RID font_rid;
+		int64_t font_size = 0;
+		uint64_t font_version = 0;
+		hb_direction_t direction = HB_DIRECTION_INVALID;
+		hb_script_t script = HB_SCRIPT_INVALID;
+		uint32_t flags = 0;
+		String language;
+		Vector<uint32_t> features; // Tag and value pairs.
+		String text; // Run text, including the surrounding context.
+		int64_t item_offset = 0;
+		int64_t item_length = 0;
+		uint32_t hash = 0;
+
+		void update_hash();
+		bool operator==(const ShapingCacheKey &p_b) const;
+	};
+
+	struct ShapingCacheKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const ShapingCacheKey &p_key) { return p_key.hash; }
+	};
+
+	struct ShapingCacheEntry {
+		ShapingCacheKey key;
+		Vector<hb_glyph_info_t> glyph_info; // Clusters are relative to the run start.
+		Vector<hb_glyph_position_t> glyph_pos;
+		int64_t memory = 0;
+	};
+
+	Mutex shaping_cache_mutex;
+	List<ShapingCacheEntry> shaping_cache_lru; // Most recently used first.
+	HashMap<ShapingCacheKey, List<ShapingCacheEntry>::Element *, ShapingCacheKeyHasher> shaping_cache;
+	int64_t shaping_cache_max_memory = 4 * 1024 * 1024; // In bytes, 0 disables the cache.
+	int64_t shaping_cache_memory = 0;
+	uint64_t shaping_cache_hits = 0;
+	uint64_t shaping_cache_misses = 0;
+	uint64_t shaping_cache_evictions = 0;
+
+	bool _shaping_cache_get(const ShapingCacheKey &p_key, Vector<hb_glyph_info_t> &r_glyph_info, Vector<hb_glyph_position_t> &r_glyph_pos);
+	void _shaping_cache_insert(const ShapingCacheKey &p_key, const hb_glyph_info_t *p_glyph_info, const hb_glyph_position_t *p_glyph_pos, unsigned int p_glyph_count, int64_t p_run_start);
+	void _shaping_cache_trim();
+
 	// Common data.
 
 	double oversampling = 1.0;
@@ -444,7 +506,7 @@ class TextServerAdvanced : public TextServerExtension {
 	};
 
 protected:
-	static void _bind_methods(){};
+	static void _bind_methods();
 
 	void full_copy(ShapedTextDataAdvanced *p_shaped);
 	void invalidate(ShapedTextDataAdvanced *p_shaped, bool p_text = false);
@@ -694,6 +756,15 @@ public:
 	virtual String string_to_upper(const String &p_string, const String &p_language = "") const override;
 	virtual String string_to_lower(const String &p_string, const String &p_language = "") const override;
 
+	void set_shaping_cache_max_memory(int64_t p_bytes);
+	int64_t get_shaping_cache_max_memory() const;
+	void clear_shaping_cache();
+
+	void set_glyph_cache_max_memory(int64_t p_bytes);
+	int64_t get_glyph_cache_max_memory() const;
+
+	Dictionary get_cache_statistics();
+
 	TextServerAdvanced();
 	~TextServerAdvanced();
 };
@@ -38,6 +38,10 @@ int AudioStreamPlaybackOGGVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 	ERR_FAIL_COND_V(!ready, 0);
 	ERR_FAIL_COND_V(!active, 0);
 
+	if (seek_pending) {
+		_seek_internal(float(frames_mixed) / vorbis_data->get_sampling_rate());
+	}
+
 	int todo = p_frames;
 
 	int start_buffer = 0;
@@ -62,7 +66,7 @@ int AudioStreamPlaybackOGGVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (vorbis_stream->loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek_internal(vorbis_stream->loop_offset);
 				loops++;
 				// we still have buffer to fill, start from this element in the next iteration.
 				start_buffer = p_frames - todo;
@@ -122,6 +126,52 @@ int AudioStreamPlaybackOGGVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p
 	return frames;
 }
 
+int AudioStreamPlaybackOGGVorbis::_skip_internal(int p_frames) {
+	ERR_FAIL_COND_V(!ready, -1);
+	if (!active) {
+		return 0;
+	}
+
+	const double sampling_rate = vorbis_data->get_sampling_rate();
+	const int64_t length_frames = int64_t(vorbis_stream->get_length() * sampling_rate);
+	if (length_frames <= 0) {
+		return -1;
+	}
+
+	int64_t position = int64_t(frames_mixed) + p_frames;
+	if (position >= length_frames) {
+		if (!vorbis_stream->loop) {
+			active = false;
+			return p_frames - int(position - length_frames);
+		}
+		const int64_t loop_offset_frames = int64_t(vorbis_stream->loop_offset * sampling_rate);
+		if (loop_offset_frames >= length_frames) {
+			return -1;
+		}
+		const int64_t loop_frames = length_frames - loop_offset_frames;
+		loops += int((position - length_frames) / loop_frames) + 1;
+		position = loop_offset_frames + (position - length_frames) % loop_frames;
+	}
+
+	frames_mixed = uint32_t(position);
+	seek_pending = true;
+	return p_frames;
+}
+
+bool AudioStreamPlaybackOGGVorbis::_can_skip_internal() const {
+	if (!ready) {
+		return false;
+	}
+
+	// Same conditions as in _skip_internal().
+	const double sampling_rate = vorbis_data->get_sampling_rate();
+	const int64_t length_frames = int64_t(vorbis_stream->get_length() * sampling_rate);
+	if (length_frames <= 0) {
+		return false;
+	}
+	return !vorbis_stream->loop || int64_t(vorbis_stream->loop_offset * sampling_rate) < length_frames;
+}
+
 float AudioStreamPlaybackOGGVorbis::get_stream_sampling_rate() {
 	return vorbis_data->get_sampling_rate();
 }
@@ -163,17 +213,23 @@ bool AudioStreamPlaybackOGGVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOGGVorbis::start(float p_from_pos) {
 	ERR_FAIL_COND(!ready);
-	active = true;
-	seek(p_from_pos);
+	end_decode_ahead();
+	_seek_internal(p_from_pos);
 	loops = 0;
 	begin_resample();
+	begin_decode_ahead();
 }
 
 void AudioStreamPlaybackOGGVorbis::stop() {
+	end_decode_ahead();
 	active = false;
 }
 
 bool AudioStreamPlaybackOGGVorbis::is_playing() const {
+	if (is_decode_ahead_active()) {
+		// The decoder belongs to the decode-ahead thread, and may be done before its frames are mixed.
+		return !is_decode_ahead_drained();
+	}
 	return active;
 }
 
@@ -182,15 +238,29 @@ int AudioStreamPlaybackOGGVorbis::get_loop_count() const {
 }
 
 float AudioStreamPlaybackOGGVorbis::get_playback_position() const {
-	return float(frames_mixed) / vorbis_data->get_sampling_rate();
+	// Frames decoded ahead haven't been heard yet.
+	return float(MAX(int64_t(frames_mixed) - get_decode_ahead_frames(), 0)) / vorbis_data->get_sampling_rate();
 }
 
 void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
-	ERR_FAIL_COND(!ready);
-	ERR_FAIL_COND(vorbis_stream.is_null());
+	if (is_decode_ahead_active()) {
+		// The decoder belongs to the decode-ahead thread, it seeks before decoding its next chunk.
+		request_decode_ahead_seek(p_time);
+		return;
+	}
 	if (!active) {
 		return;
 	}
+	_seek_internal(p_time);
+}
+
+void AudioStreamPlaybackOGGVorbis::_seek_internal(float p_time) {
+	ERR_FAIL_COND(!ready);
+	ERR_FAIL_COND(vorbis_stream.is_null());
+
+	// Seeking restarts a decoder that reached the end.
+	active = true;
+	seek_pending = false;
 
 	vorbis_synthesis_restart(&dsp_state);
 
@@ -304,6 +374,7 @@ void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
 }
 
 AudioStreamPlaybackOGGVorbis::~AudioStreamPlaybackOGGVorbis() {
+	end_decode_ahead();
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
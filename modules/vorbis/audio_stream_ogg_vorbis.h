@@ -43,6 +43,8 @@ class AudioStreamPlaybackOGGVorbis : public AudioStreamPlaybackResampled {
 
 	uint32_t frames_mixed = 0;
 	bool active = false;
+	// Set when the playback was skipped ahead, the decoder seeks to frames_mixed before mixing again.
+	bool seek_pending = false;
 	int loops = 0;
 
 	vorbis_info info;
@@ -73,6 +75,9 @@ class AudioStreamPlaybackOGGVorbis : public AudioStreamPlaybackResampled {
 
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
+	virtual int _skip_internal(int p_frames) override;
+	virtual bool _can_skip_internal() const override;
+	virtual void _seek_internal(float p_time) override;
 	virtual float get_stream_sampling_rate() override;
 
 public:
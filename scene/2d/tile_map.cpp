@@ -31,9 +31,14 @@
 #include "tile_map.h"
 
 #include "core/io/marshalls.h"
+#include "core/math/geometry_2d.h"
 #include "scene/resources/world_2d.h"
 #include "servers/navigation_server_2d.h"
 
+ThreadWorkPool TileMap::quadrant_update_work_pool;
+Mutex TileMap::quadrant_update_work_pool_mutex;
+int TileMap::quadrant_update_work_pool_users = 0;
+
 HashMap<Vector2i, TileSet::CellNeighbor> TileMap::TerrainConstraint::get_overlapping_coords_and_peering_bits() const {
 	HashMap<Vector2i, TileSet::CellNeighbor> output;
 	Ref<TileSet> tile_set = tile_map->get_tileset();
@@ -704,6 +709,17 @@ bool TileMap::is_collision_animatable() const {
 	return collision_animatable;
 }
 
+void TileMap::set_collision_merging_enabled(bool p_enabled) {
+	collision_merging_enabled = p_enabled;
+	_clear_internals();
+	_recreate_internals();
+	emit_signal(SNAME("changed"));
+}
+
+bool TileMap::is_collision_merging_enabled() const {
+	return collision_merging_enabled;
+}
+
 void TileMap::set_collision_visibility_mode(TileMap::VisibilityMode p_show_collision) {
 	collision_visibility_mode = p_show_collision;
 	_clear_internals();
@@ -806,18 +822,14 @@ void TileMap::_update_dirty_quadrants() {
 	for (unsigned int layer = 0; layer < layers.size(); layer++) {
 		SelfList<TileMapQuadrant>::List &dirty_quadrant_list = layers[layer].dirty_quadrant_list;
 
-		// Update the coords cache.
+		quadrant_update_list.clear();
 		for (SelfList<TileMapQuadrant> *q = dirty_quadrant_list.first(); q; q = q->next()) {
-			q->self()->map_to_world.clear();
-			q->self()->world_to_map.clear();
-			for (const Vector2i &E : q->self()->cells) {
-				Vector2i pk = E;
-				Vector2i pk_world_coords = map_to_world(pk);
-				q->self()->map_to_world[pk] = pk_world_coords;
-				q->self()->world_to_map[pk_world_coords] = pk;
-			}
+			quadrant_update_list.push_back(q->self());
 		}
 
+		// Update the coords cache.
+		_run_quadrant_update_work(&TileMap::_update_quadrant_coords_cache);
+
 		// Find TileData that need a runtime modification.
 		_build_runtime_update_tile_data(dirty_quadrant_list);
 
@@ -851,12 +863,43 @@ void TileMap::_update_dirty_quadrants() {
 			dirty_quadrant_list.remove(dirty_quadrant_list.first());
 		}
 	}
+	quadrant_update_list.clear();
 
 	pending_update = false;
 
 	_recompute_rect_cache();
 }
 
+void TileMap::_run_quadrant_update_work(void (TileMap::*p_method)(uint32_t, void *)) {
+	uint32_t count = quadrant_update_list.size();
+#ifndef NO_THREADS
+	// If another thread is using the shared pool, update on this one instead of waiting.
+	if (count >= QUADRANT_UPDATE_THREADING_THRESHOLD && quadrant_update_work_pool_mutex.try_lock() == OK) {
+		if (quadrant_update_work_pool.get_thread_count() == 0) {
+			quadrant_update_work_pool.init();
+		}
+		quadrant_update_work_pool.do_work(count, this, p_method, nullptr);
+		quadrant_update_work_pool_mutex.unlock();
+		return;
+	}
+#endif
+	for (uint32_t i = 0; i < count; i++) {
+		(this->*p_method)(i, nullptr);
+	}
+}
+
+void TileMap::_update_quadrant_coords_cache(uint32_t p_index, void *p_userdata) {
+	TileMapQuadrant *q = quadrant_update_list[p_index];
+	q->map_to_world.clear();
+	q->world_to_map.clear();
+	for (const Vector2i &E : q->cells) {
+		Vector2i pk = E;
+		Vector2i pk_world_coords = map_to_world(pk);
+		q->map_to_world[pk] = pk_world_coords;
+		q->world_to_map[pk_world_coords] = pk;
+	}
+}
+
 void TileMap::_recreate_layer_internals(int p_layer) {
 	ERR_FAIL_INDEX(p_layer, (int)layers.size());
 
@@ -1063,18 +1106,181 @@ void TileMap::_rendering_cleanup_layer(int p_layer) {
 	}
 }
 
+Color TileMap::_rendering_get_layer_modulate(int p_layer) const {
+	Color modulate = get_self_modulate();
+	modulate *= get_layer_modulate(p_layer);
+	if (selected_layer >= 0) {
+		int z1 = get_layer_z_index(p_layer);
+		int z2 = get_layer_z_index(selected_layer);
+		if (z1 < z2 || (z1 == z2 && p_layer < selected_layer)) {
+			modulate = modulate.darkened(0.5);
+		} else if (z1 > z2 || (z1 == z2 && p_layer > selected_layer)) {
+			modulate = modulate.darkened(0.5);
+			modulate.a *= 0.3;
+		}
+	}
+	return modulate;
+}
+
+void TileMap::_rendering_update_texture_rids() {
+	// Texture2D::get_rid() may create a placeholder through the RenderingServer, so don't call it on the worker threads.
+	quadrant_update_texture_rids.clear();
+	for (int i = 0; i < tile_set->get_source_count(); i++) {
+		int source_id = tile_set->get_source_id(i);
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(source_id));
+		if (atlas_source && atlas_source->get_runtime_texture().is_valid()) {
+			quadrant_update_texture_rids[source_id] = atlas_source->get_runtime_texture()->get_rid();
+		}
+	}
+}
+
+void TileMap::_rendering_bake_quadrant(uint32_t p_index, void *p_userdata) {
+	// Runs on worker threads: only read the TileMap and TileSet state here, no server calls.
+	TileMapQuadrant &q = *quadrant_update_list[p_index];
+	q.baked_canvas_items.clear();
+	q.baked_cells.clear();
+
+	Color modulate = _rendering_get_layer_modulate(q.layer);
+	Vector2 quadrant_position = map_to_world(q.coords * get_effective_quadrant_size(q.layer));
+	bool y_sorted = is_y_sort_enabled() && layers[q.layer].y_sort_enabled;
+	bool uv_clipping = tile_set->is_uv_clipping();
+
+	TileMapQuadrant::BakedCanvasItem *item = nullptr;
+	TileMapQuadrant::BakedSegment *segment = nullptr;
+
+	// Iterate over the cells of the quadrant.
+	for (const KeyValue<Vector2i, Vector2i> &E_cell : q.world_to_map) {
+		TileMapCell c = get_cell(q.layer, E_cell.value, true);
+
+		if (!tile_set->has_source(c.source_id)) {
+			continue;
+		}
+		TileSetSource *source = *tile_set->get_source(c.source_id);
+		Vector2i atlas_coords = c.get_atlas_coords();
+		if (!source->has_tile(atlas_coords) || !source->has_alternative_tile(atlas_coords, c.alternative_tile)) {
+			continue;
+		}
+
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+		if (!atlas_source) {
+			continue;
+		}
+
+		// Get the tile data.
+		const TileData *tile_data;
+		TileData *const *runtime_tile_data = q.runtime_tile_data_cache.getptr(E_cell.value);
+		if (runtime_tile_data) {
+			tile_data = *runtime_tile_data;
+		} else {
+			tile_data = atlas_source->get_tile_data(atlas_coords, c.alternative_tile);
+		}
+
+		TileMapQuadrant::BakedCell baked_cell;
+		baked_cell.world_coords = E_cell.key;
+		baked_cell.tile_data = tile_data;
+		q.baked_cells.push_back(baked_cell);
+
+		// Group cells per material and z-index, each group becomes a CanvasItem.
+		Ref<ShaderMaterial> mat = tile_data->get_material();
+		int z_index = tile_data->get_z_index();
+		if (!item || item->material != mat || item->z_index != z_index) {
+			q.baked_canvas_items.push_back(TileMapQuadrant::BakedCanvasItem());
+			item = &q.baked_canvas_items[q.baked_canvas_items.size() - 1];
+			item->material = mat;
+			item->z_index = z_index;
+			item->position = quadrant_position;
+			if (y_sorted) {
+				// When Y-sorting, the quandrant size is sure to be 1, we can thus offset the CanvasItem.
+				item->position.y += layers[q.layer].y_sort_origin + tile_data->get_y_sort_origin();
+			}
+			segment = nullptr;
+		}
+
+		Ref<Texture2D> tex = atlas_source->get_runtime_texture();
+		if (!tex.is_valid()) {
+			continue;
+		}
+		Vector2i grid_size = atlas_source->get_atlas_grid_size();
+		if (atlas_coords.x >= grid_size.x || atlas_coords.y >= grid_size.y) {
+			continue;
+		}
+
+		Vector2i tile_position = E_cell.key - item->position;
+
+		// Only textures drawn as a plain texture rect can be merged, other tiles keep going through draw_tile().
+		bool bakeable = !uv_clipping && atlas_source->get_tile_animation_frames_count(atlas_coords) == 1;
+		bakeable = bakeable && (Object::cast_to<ImageTexture>(*tex) || Object::cast_to<CompressedTexture2D>(*tex) || Object::cast_to<PortableCompressedTexture2D>(*tex));
+		if (!bakeable) {
+			item->segments.push_back(TileMapQuadrant::BakedSegment());
+			TileMapQuadrant::BakedSegment &tile_segment = item->segments[item->segments.size() - 1];
+			tile_segment.draw_tile = true;
+			tile_segment.cell = c;
+			tile_segment.tile_position = tile_position;
+			tile_segment.tile_data = tile_data;
+			segment = nullptr;
+			continue;
+		}
+
+		Size2 texture_size = tex->get_size();
+		if (texture_size.x <= 0 || texture_size.y <= 0) {
+			continue;
+		}
+		const RID *texture_rid = quadrant_update_texture_rids.getptr(c.source_id);
+		if (!texture_rid) {
+			continue;
+		}
+		if (!segment || segment->texture != *texture_rid) {
+			item->segments.push_back(TileMapQuadrant::BakedSegment());
+			segment = &item->segments[item->segments.size() - 1];
+			segment->texture = *texture_rid;
+		}
+
+		// Same placement as draw_tile(), expressed as a quad.
+		Vector2i tile_offset = atlas_source->get_tile_effective_texture_offset(atlas_coords, c.alternative_tile);
+		Rect2 source_rect = atlas_source->get_runtime_tile_texture_region(atlas_coords, 0);
+		Size2 dest_size = source_rect.size + Size2(FP_ADJUST, FP_ADJUST);
+		bool transpose = tile_data->get_transpose();
+		if (transpose) {
+			SWAP(dest_size.x, dest_size.y);
+		}
+		Vector2 dest_position = Vector2(tile_position) - dest_size / 2 - tile_offset;
+		bool flip_h = tile_data->get_flip_h();
+		bool flip_v = tile_data->get_flip_v();
+		Color tile_modulate = tile_data->get_modulate() * modulate;
+
+		int first_vertex = segment->points.size();
+		static const Vector2 corners[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+		for (int i = 0; i < 4; i++) {
+			Vector2 corner = corners[i];
+			Vector2 vertex_corner = Vector2(flip_h ? 1.0 - corner.x : corner.x, flip_v ? 1.0 - corner.y : corner.y);
+			Vector2 uv_corner = transpose ? Vector2(corner.y, corner.x) : corner;
+			segment->points.push_back(dest_position + dest_size * vertex_corner);
+			segment->uvs.push_back((source_rect.position + source_rect.size * uv_corner) / texture_size);
+			segment->colors.push_back(tile_modulate);
+		}
+		static const int quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+		for (int i = 0; i < 6; i++) {
+			segment->indices.push_back(first_vertex + quad_indices[i]);
+		}
+	}
+}
+
 void TileMap::_rendering_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list) {
 	ERR_FAIL_COND(!is_inside_tree());
 	ERR_FAIL_COND(!tile_set.is_valid());
 
 	bool visible = is_visible_in_tree();
 
+	// Bake the quadrants geometry, possibly on several threads.
+	_rendering_update_texture_rids();
+	_run_quadrant_update_work(&TileMap::_rendering_bake_quadrant);
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+
 	SelfList<TileMapQuadrant> *q_list_element = r_dirty_quadrant_list.first();
 	while (q_list_element) {
 		TileMapQuadrant &q = *q_list_element->self();
 
-		RenderingServer *rs = RenderingServer::get_singleton();
-
 		// Free the canvas items.
 		for (const RID &ci : q.canvas_items) {
 			rs->free(ci);
@@ -1087,112 +1293,63 @@ void TileMap::_rendering_update_dirty_quadrants(SelfList<TileMapQuadrant>::List
 		}
 		q.occluders.clear();
 
-		// Those allow to group cell per material or z-index.
-		Ref<ShaderMaterial> prev_material;
-		int prev_z_index = 0;
-		RID prev_canvas_item;
-
-		Color modulate = get_self_modulate();
-		modulate *= get_layer_modulate(q.layer);
-		if (selected_layer >= 0) {
-			int z1 = get_layer_z_index(q.layer);
-			int z2 = get_layer_z_index(selected_layer);
-			if (z1 < z2 || (z1 == z2 && q.layer < selected_layer)) {
-				modulate = modulate.darkened(0.5);
-			} else if (z1 > z2 || (z1 == z2 && q.layer > selected_layer)) {
-				modulate = modulate.darkened(0.5);
-				modulate.a *= 0.3;
-			}
-		}
-
-		// Iterate over the cells of the quadrant.
-		for (const KeyValue<Vector2i, Vector2i> &E_cell : q.world_to_map) {
-			TileMapCell c = get_cell(q.layer, E_cell.value, true);
-
-			TileSetSource *source;
-			if (tile_set->has_source(c.source_id)) {
-				source = *tile_set->get_source(c.source_id);
+		Color modulate = _rendering_get_layer_modulate(q.layer);
 
-				if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-					continue;
-				}
+		// --- CanvasItems ---
+		for (uint32_t item_index = 0; item_index < q.baked_canvas_items.size(); item_index++) {
+			const TileMapQuadrant::BakedCanvasItem &item = q.baked_canvas_items[item_index];
 
-				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-				if (atlas_source) {
-					// Get the tile data.
-					const TileData *tile_data;
-					if (q.runtime_tile_data_cache.has(E_cell.value)) {
-						tile_data = q.runtime_tile_data_cache[E_cell.value];
-					} else {
-						tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
-					}
-
-					Ref<ShaderMaterial> mat = tile_data->get_material();
-					int z_index = tile_data->get_z_index();
-
-					// Quandrant pos.
-					Vector2 position = map_to_world(q.coords * get_effective_quadrant_size(q.layer));
-					if (is_y_sort_enabled() && layers[q.layer].y_sort_enabled) {
-						// When Y-sorting, the quandrant size is sure to be 1, we can thus offset the CanvasItem.
-						position.y += layers[q.layer].y_sort_origin + tile_data->get_y_sort_origin();
-					}
-
-					// --- CanvasItems ---
-					// Create two canvas items, for rendering and debug.
-					RID canvas_item;
-
-					// Check if the material or the z_index changed.
-					if (prev_canvas_item == RID() || prev_material != mat || prev_z_index != z_index) {
-						// If so, create a new CanvasItem.
-						canvas_item = rs->canvas_item_create();
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(canvas_item, mat->get_rid());
-						}
-						rs->canvas_item_set_parent(canvas_item, layers[q.layer].canvas_item);
-						rs->canvas_item_set_use_parent_material(canvas_item, get_use_parent_material() || get_material().is_valid());
-
-						Transform2D xform;
-						xform.set_origin(position);
-						rs->canvas_item_set_transform(canvas_item, xform);
+			RID canvas_item = rs->canvas_item_create();
+			if (item.material.is_valid()) {
+				rs->canvas_item_set_material(canvas_item, item.material->get_rid());
+			}
+			rs->canvas_item_set_parent(canvas_item, layers[q.layer].canvas_item);
+			rs->canvas_item_set_use_parent_material(canvas_item, get_use_parent_material() || get_material().is_valid());
 
-						rs->canvas_item_set_light_mask(canvas_item, get_light_mask());
-						rs->canvas_item_set_z_index(canvas_item, z_index);
+			Transform2D xform;
+			xform.set_origin(item.position);
+			rs->canvas_item_set_transform(canvas_item, xform);
 
-						rs->canvas_item_set_default_texture_filter(canvas_item, RS::CanvasItemTextureFilter(get_texture_filter()));
-						rs->canvas_item_set_default_texture_repeat(canvas_item, RS::CanvasItemTextureRepeat(get_texture_repeat()));
+			rs->canvas_item_set_light_mask(canvas_item, get_light_mask());
+			rs->canvas_item_set_z_index(canvas_item, item.z_index);
 
-						q.canvas_items.push_back(canvas_item);
+			rs->canvas_item_set_default_texture_filter(canvas_item, RS::CanvasItemTextureFilter(get_texture_filter()));
+			rs->canvas_item_set_default_texture_repeat(canvas_item, RS::CanvasItemTextureRepeat(get_texture_repeat()));
 
-						prev_canvas_item = canvas_item;
-						prev_material = mat;
-						prev_z_index = z_index;
+			q.canvas_items.push_back(canvas_item);
 
-					} else {
-						// Keep the same canvas_item to draw on.
-						canvas_item = prev_canvas_item;
-					}
-
-					// Drawing the tile in the canvas item.
-					draw_tile(canvas_item, E_cell.key - position, tile_set, c.source_id, c.get_atlas_coords(), c.alternative_tile, -1, modulate, tile_data);
+			// Drawing the tiles in the canvas item.
+			for (uint32_t segment_index = 0; segment_index < item.segments.size(); segment_index++) {
+				const TileMapQuadrant::BakedSegment &segment = item.segments[segment_index];
+				if (segment.draw_tile) {
+					draw_tile(canvas_item, segment.tile_position, tile_set, segment.cell.source_id, segment.cell.get_atlas_coords(), segment.cell.alternative_tile, -1, modulate, segment.tile_data);
+				} else {
+					rs->canvas_item_add_triangle_array(canvas_item, segment.indices, segment.points, segment.colors, segment.uvs, Vector<int>(), Vector<float>(), segment.texture);
+				}
+			}
+		}
 
-					// --- Occluders ---
-					for (int i = 0; i < tile_set->get_occlusion_layers_count(); i++) {
-						Transform2D xform;
-						xform.set_origin(E_cell.key);
-						if (tile_data->get_occluder(i).is_valid()) {
-							RID occluder_id = rs->canvas_light_occluder_create();
-							rs->canvas_light_occluder_set_enabled(occluder_id, visible);
-							rs->canvas_light_occluder_set_transform(occluder_id, get_global_transform() * xform);
-							rs->canvas_light_occluder_set_polygon(occluder_id, tile_data->get_occluder(i)->get_rid());
-							rs->canvas_light_occluder_attach_to_canvas(occluder_id, get_canvas());
-							rs->canvas_light_occluder_set_light_mask(occluder_id, tile_set->get_occlusion_layer_light_mask(i));
-							q.occluders.push_back(occluder_id);
-						}
-					}
+		// --- Occluders ---
+		for (uint32_t cell_index = 0; cell_index < q.baked_cells.size(); cell_index++) {
+			const TileMapQuadrant::BakedCell &cell = q.baked_cells[cell_index];
+			for (int i = 0; i < tile_set->get_occlusion_layers_count(); i++) {
+				Transform2D xform;
+				xform.set_origin(cell.world_coords);
+				if (cell.tile_data->get_occluder(i).is_valid()) {
+					RID occluder_id = rs->canvas_light_occluder_create();
+					rs->canvas_light_occluder_set_enabled(occluder_id, visible);
+					rs->canvas_light_occluder_set_transform(occluder_id, get_global_transform() * xform);
+					rs->canvas_light_occluder_set_polygon(occluder_id, cell.tile_data->get_occluder(i)->get_rid());
+					rs->canvas_light_occluder_attach_to_canvas(occluder_id, get_canvas());
+					rs->canvas_light_occluder_set_light_mask(occluder_id, tile_set->get_occlusion_layer_light_mask(i));
+					q.occluders.push_back(occluder_id);
 				}
 			}
 		}
 
+		q.baked_canvas_items.clear();
+		q.baked_cells.clear();
+
 		_rendering_quadrant_order_dirty = true;
 		q_list_element = q_list_element->next();
 	}
@@ -1442,6 +1599,142 @@ void TileMap::_physics_notification(int p_what) {
 	}
 }
 
+bool TileMap::_physics_is_tile_mergeable(const TileData *p_tile_data, int p_tile_set_physics_layer) const {
+	// A body rotates around its own origin, which for a merged body is another tile's cell.
+	if (p_tile_data->get_constant_angular_velocity(p_tile_set_physics_layer) != 0.0) {
+		return false;
+	}
+
+	// One-way polygons rely on their own shape orientation, they are never merged.
+	for (int polygon_index = 0; polygon_index < p_tile_data->get_collision_polygons_count(p_tile_set_physics_layer); polygon_index++) {
+		if (p_tile_data->is_collision_polygon_one_way(p_tile_set_physics_layer, polygon_index)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void TileMap::_physics_bake_quadrant(uint32_t p_index, void *p_userdata) {
+	// Runs on worker threads: only compute the merged outlines here, bodies and shapes are created on the main thread.
+	TileMapQuadrant &q = *quadrant_update_list[p_index];
+	q.baked_collision_groups.clear();
+
+	for (const Vector2i &E_cell : q.cells) {
+		TileMapCell c = get_cell(q.layer, E_cell, true);
+
+		if (!tile_set->has_source(c.source_id)) {
+			continue;
+		}
+		TileSetSource *source = *tile_set->get_source(c.source_id);
+		if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+			continue;
+		}
+
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+		if (!atlas_source) {
+			continue;
+		}
+
+		const TileData *tile_data;
+		TileData *const *runtime_tile_data = q.runtime_tile_data_cache.getptr(E_cell);
+		if (runtime_tile_data) {
+			tile_data = *runtime_tile_data;
+		} else {
+			tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+		}
+
+		Vector2 cell_position = map_to_world(E_cell);
+		for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+			int polygons_count = tile_data->get_collision_polygons_count(tile_set_physics_layer);
+			if (polygons_count == 0 || !_physics_is_tile_mergeable(tile_data, tile_set_physics_layer)) {
+				continue;
+			}
+
+			// Tiles can only share a body if they have the same constant linear velocity.
+			Vector2 linear_velocity = tile_data->get_constant_linear_velocity(tile_set_physics_layer);
+			TileMapQuadrant::BakedCollisionGroup *group = nullptr;
+			for (uint32_t i = 0; i < q.baked_collision_groups.size(); i++) {
+				TileMapQuadrant::BakedCollisionGroup &candidate = q.baked_collision_groups[i];
+				if (candidate.physics_layer == tile_set_physics_layer && candidate.linear_velocity == linear_velocity) {
+					group = &candidate;
+					break;
+				}
+			}
+			if (!group) {
+				q.baked_collision_groups.push_back(TileMapQuadrant::BakedCollisionGroup());
+				group = &q.baked_collision_groups[q.baked_collision_groups.size() - 1];
+				group->physics_layer = tile_set_physics_layer;
+				group->linear_velocity = linear_velocity;
+				group->origin_coords = E_cell;
+			}
+
+			// The group body is placed on its origin cell, express the polygons relatively to it.
+			Vector2 offset = cell_position - map_to_world(group->origin_coords);
+			for (int polygon_index = 0; polygon_index < polygons_count; polygon_index++) {
+				Vector<Vector2> polygon = tile_data->get_collision_polygon_points(tile_set_physics_layer, polygon_index);
+				if (polygon.size() < 3) {
+					continue;
+				}
+				Vector2 *polygon_ptrw = polygon.ptrw();
+				for (int i = 0; i < polygon.size(); i++) {
+					polygon_ptrw[i] += offset;
+				}
+				group->polygons.push_back(polygon);
+			}
+		}
+	}
+
+	// Union the polygons, then keep the outlines (and holes) as segments.
+	for (uint32_t group_index = 0; group_index < q.baked_collision_groups.size(); group_index++) {
+		TileMapQuadrant::BakedCollisionGroup &group = q.baked_collision_groups[group_index];
+		Vector<Vector<Vector2>> outlines = Geometry2D::merge_many_polygons(group.polygons);
+		group.polygons.clear();
+		for (int outline_index = 0; outline_index < outlines.size(); outline_index++) {
+			const Vector<Vector2> &outline = outlines[outline_index];
+			for (int i = 0; i < outline.size(); i++) {
+				group.segments.push_back(outline[i]);
+				group.segments.push_back(outline[(i + 1) % outline.size()]);
+			}
+		}
+	}
+}
+
+RID TileMap::_physics_create_body(const Vector2i &p_coords, int p_tile_set_physics_layer, const Vector2 &p_linear_velocity, real_t p_angular_velocity) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(p_tile_set_physics_layer);
+	uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(p_tile_set_physics_layer);
+	uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(p_tile_set_physics_layer);
+
+	// Create the body.
+	RID body = ps->body_create();
+	bodies_coords[body] = p_coords;
+	ps->body_set_mode(body, collision_animatable ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_set_space(body, get_world_2d()->get_space());
+
+	Transform2D xform;
+	xform.set_origin(map_to_world(p_coords));
+	xform = get_global_transform() * xform;
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+
+	ps->body_attach_object_instance_id(body, get_instance_id());
+	ps->body_set_collision_layer(body, physics_layer);
+	ps->body_set_collision_mask(body, physics_mask);
+	ps->body_set_pickable(body, false);
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, p_linear_velocity);
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, p_angular_velocity);
+
+	if (!physics_material.is_valid()) {
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+	} else {
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+	}
+
+	return body;
+}
+
 void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list) {
 	ERR_FAIL_COND(!is_inside_tree());
 	ERR_FAIL_COND(!tile_set.is_valid());
@@ -1450,7 +1743,11 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 	last_valid_transform = global_transform;
 	new_transform = global_transform;
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
-	RID space = get_world_2d()->get_space();
+
+	// Merge the collision polygons, possibly on several threads.
+	if (collision_merging_enabled) {
+		_run_quadrant_update_work(&TileMap::_physics_bake_quadrant);
+	}
 
 	SelfList<TileMapQuadrant> *q_list_element = r_dirty_quadrant_list.first();
 	while (q_list_element) {
@@ -1462,6 +1759,7 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 			ps->free(body);
 		}
 		q.bodies.clear();
+		q.merged_collision_shapes.clear();
 
 		// Recreate bodies and shapes.
 		for (const Vector2i &E_cell : q.cells) {
@@ -1484,36 +1782,12 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 						tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
 					}
 					for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-						Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-						uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-						uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
-
-						// Create the body.
-						RID body = ps->body_create();
-						bodies_coords[body] = E_cell;
-						ps->body_set_mode(body, collision_animatable ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
-
-						Transform2D xform;
-						xform.set_origin(map_to_world(E_cell));
-						xform = global_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (!physics_material.is_valid()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+						if (collision_merging_enabled && _physics_is_tile_mergeable(tile_data, tile_set_physics_layer)) {
+							// Part of the quadrant merged bodies.
+							continue;
 						}
 
+						RID body = _physics_create_body(E_cell, tile_set_physics_layer, tile_data->get_constant_linear_velocity(tile_set_physics_layer), tile_data->get_constant_angular_velocity(tile_set_physics_layer));
 						q.bodies.push_back(body);
 
 						// Add the shapes to the body.
@@ -1537,6 +1811,24 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 			}
 		}
 
+		// Create the merged bodies, a single concave shape each.
+		for (uint32_t group_index = 0; group_index < q.baked_collision_groups.size(); group_index++) {
+			const TileMapQuadrant::BakedCollisionGroup &group = q.baked_collision_groups[group_index];
+			if (group.segments.is_empty()) {
+				continue;
+			}
+
+			Ref<ConcavePolygonShape2D> shape;
+			shape.instantiate();
+			shape->set_segments(group.segments);
+			q.merged_collision_shapes.push_back(shape);
+
+			RID body = _physics_create_body(group.origin_coords, group.physics_layer, group.linear_velocity, 0.0);
+			ps->body_add_shape(body, shape->get_rid());
+			q.bodies.push_back(body);
+		}
+		q.baked_collision_groups.clear();
+
 		q_list_element = q_list_element->next();
 	}
 }
@@ -1548,6 +1840,7 @@ void TileMap::_physics_cleanup_quadrant(TileMapQuadrant *p_quadrant) {
 		PhysicsServer2D::get_singleton()->free(body);
 	}
 	p_quadrant->bodies.clear();
+	p_quadrant->merged_collision_shapes.clear();
 }
 
 void TileMap::_physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant) {
@@ -1595,8 +1888,12 @@ void TileMap::_physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant) {
 			if (type == PhysicsServer2D::SHAPE_CONVEX_POLYGON) {
 				Vector<Vector2> polygon = ps->shape_get_data(shape);
 				rs->canvas_item_add_polygon(p_quadrant->debug_canvas_item, polygon, color);
+			} else if (type == PhysicsServer2D::SHAPE_CONCAVE_POLYGON) {
+				// Merged collision outlines.
+				Vector<Vector2> segments = ps->shape_get_data(shape);
+				rs->canvas_item_add_multiline(p_quadrant->debug_canvas_item, segments, color);
 			} else {
-				WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON.");
+				WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON or SHAPE_CONCAVE_POLYGON.");
 			}
 		}
 		rs->canvas_item_add_set_transform(p_quadrant->debug_canvas_item, Transform2D());
@@ -2408,6 +2705,21 @@ HashMap<Vector2i, TileMapQuadrant> *TileMap::get_quadrant_map(int p_layer) {
 	return &layers[p_layer].quadrant_map;
 }
 
+void TileMap::bake_quadrants_rendering(int p_layer) {
+	ERR_FAIL_INDEX(p_layer, (int)layers.size());
+	ERR_FAIL_COND(!tile_set.is_valid());
+
+	// Same steps as a quadrant update, but the baked geometry is kept in the quadrants instead of being submitted.
+	quadrant_update_list.clear();
+	for (KeyValue<Vector2i, TileMapQuadrant> &E : layers[p_layer].quadrant_map) {
+		quadrant_update_list.push_back(&E.value);
+	}
+	_run_quadrant_update_work(&TileMap::_update_quadrant_coords_cache);
+	_rendering_update_texture_rids();
+	_run_quadrant_update_work(&TileMap::_rendering_bake_quadrant);
+	quadrant_update_list.clear();
+}
+
 Vector2i TileMap::get_coords_for_body_rid(RID p_physics_body) {
 	ERR_FAIL_COND_V_MSG(!bodies_coords.has(p_physics_body), Vector2i(), vformat("No tiles for the given body RID %d.", p_physics_body));
 	return bodies_coords[p_physics_body];
@@ -3622,6 +3934,8 @@ void TileMap::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_collision_animatable", "enabled"), &TileMap::set_collision_animatable);
 	ClassDB::bind_method(D_METHOD("is_collision_animatable"), &TileMap::is_collision_animatable);
+	ClassDB::bind_method(D_METHOD("set_collision_merging_enabled", "enabled"), &TileMap::set_collision_merging_enabled);
+	ClassDB::bind_method(D_METHOD("is_collision_merging_enabled"), &TileMap::is_collision_merging_enabled);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "collision_visibility_mode"), &TileMap::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMap::get_collision_visibility_mode);
 
@@ -3668,6 +3982,7 @@ void TileMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tile_set", PROPERTY_HINT_RESOURCE_TYPE, "TileSet"), "set_tileset", "get_tileset");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "cell_quadrant_size", PROPERTY_HINT_RANGE, "1,128,1"), "set_quadrant_size", "get_quadrant_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_animatable"), "set_collision_animatable", "is_collision_animatable");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_merging_enabled"), "set_collision_merging_enabled", "is_collision_merging_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_navigation_visibility_mode", "get_navigation_visibility_mode");
 
@@ -3701,6 +4016,9 @@ TileMap::TileMap() {
 	set_notify_local_transform(false);
 
 	layers.resize(1);
+
+	MutexLock lock(quadrant_update_work_pool_mutex);
+	quadrant_update_work_pool_users++;
 }
 
 TileMap::~TileMap() {
@@ -3709,4 +4027,10 @@ TileMap::~TileMap() {
 	}
 
 	_clear_internals();
+
+	MutexLock lock(quadrant_update_work_pool_mutex);
+	quadrant_update_work_pool_users--;
+	if (quadrant_update_work_pool_users == 0) {
+		quadrant_update_work_pool.finish();
+	}
 }
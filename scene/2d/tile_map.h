@@ -31,6 +31,7 @@
 #ifndef TILE_MAP_H
 #define TILE_MAP_H
 
+#include "core/templates/thread_work_pool.h"
 #include "scene/2d/node_2d.h"
 #include "scene/gui/control.h"
 #include "scene/resources/tile_set.h"
@@ -70,8 +71,47 @@ struct TileMapQuadrant {
 	List<RID> canvas_items;
 	List<RID> occluders;
 
+	// Rendering data baked off the main thread, consumed when submitting to the RenderingServer.
+	struct BakedSegment {
+		// Consecutive tiles sharing a texture, merged into a single triangle array.
+		RID texture;
+		Vector<Vector2> points;
+		Vector<Vector2> uvs;
+		Vector<Color> colors;
+		Vector<int> indices;
+
+		// Set when the tile cannot be baked (animated, UV clipped or custom texture), it is then drawn with draw_tile().
+		bool draw_tile = false;
+		TileMapCell cell;
+		Vector2i tile_position;
+		const TileData *tile_data = nullptr;
+	};
+	struct BakedCanvasItem {
+		Ref<ShaderMaterial> material;
+		int z_index = 0;
+		Vector2 position;
+		LocalVector<BakedSegment> segments;
+	};
+	struct BakedCell {
+		Vector2i world_coords;
+		const TileData *tile_data = nullptr;
+	};
+	LocalVector<BakedCanvasItem> baked_canvas_items;
+	LocalVector<BakedCell> baked_cells;
+
 	// Physics.
 	List<RID> bodies;
+	LocalVector<Ref<ConcavePolygonShape2D>> merged_collision_shapes;
+
+	// Merged collision outlines baked off the main thread, one group per physics layer and constant linear velocity.
+	struct BakedCollisionGroup {
+		int physics_layer = 0;
+		Vector2 linear_velocity;
+		Vector2i origin_coords;
+		Vector<Vector<Vector2>> polygons;
+		Vector<Vector2> segments;
+	};
+	LocalVector<BakedCollisionGroup> baked_collision_groups;
 
 	// Navigation.
 	HashMap<Vector2i, Vector<RID>> navigation_regions;
@@ -172,12 +212,24 @@ private:
 	Ref<TileSet> tile_set;
 	int quadrant_size = 16;
 	bool collision_animatable = false;
+	bool collision_merging_enabled = false;
 	VisibilityMode collision_visibility_mode = VISIBILITY_MODE_DEFAULT;
 	VisibilityMode navigation_visibility_mode = VISIBILITY_MODE_DEFAULT;
 
 	// Updates.
 	bool pending_update = false;
 
+	// Dirty quadrants are rebuilt on worker threads once there are enough of them. All TileMaps share
+	// one pool, started when first needed and finished along with the last TileMap.
+	static constexpr int QUADRANT_UPDATE_THREADING_THRESHOLD = 4;
+	static ThreadWorkPool quadrant_update_work_pool;
+	static Mutex quadrant_update_work_pool_mutex;
+	static int quadrant_update_work_pool_users;
+	LocalVector<TileMapQuadrant *> quadrant_update_list;
+	// Texture RIDs per atlas source, resolved before baking as getting them may create them.
+	HashMap<int, RID> quadrant_update_texture_rids;
+	void _run_quadrant_update_work(void (TileMap::*p_method)(uint32_t, void *));
+
 	// Rect.
 	Rect2 rect_cache;
 	bool rect_cache_dirty = true;
@@ -230,6 +282,9 @@ private:
 	void _rendering_update_layer(int p_layer);
 	void _rendering_cleanup_layer(int p_layer);
 	void _rendering_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	Color _rendering_get_layer_modulate(int p_layer) const;
+	void _rendering_update_texture_rids();
+	void _rendering_bake_quadrant(uint32_t p_index, void *p_userdata);
 	void _rendering_create_quadrant(TileMapQuadrant *p_quadrant);
 	void _rendering_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _rendering_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
@@ -237,6 +292,9 @@ private:
 	Transform2D last_valid_transform;
 	Transform2D new_transform;
 	void _physics_notification(int p_what);
+	bool _physics_is_tile_mergeable(const TileData *p_tile_data, int p_tile_set_physics_layer) const;
+	void _physics_bake_quadrant(uint32_t p_index, void *p_userdata);
+	RID _physics_create_body(const Vector2i &p_coords, int p_tile_set_physics_layer, const Vector2 &p_linear_velocity, real_t p_angular_velocity);
 	void _physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
 	void _physics_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
@@ -258,6 +316,7 @@ private:
 	Vector<int> _get_tile_data(int p_layer) const;
 
 	void _build_runtime_update_tile_data(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	void _update_quadrant_coords_cache(uint32_t p_index, void *p_userdata);
 
 	void _tile_set_changed();
 	bool _tile_set_changed_deferred_update_needed = false;
@@ -313,6 +372,9 @@ public:
 	void set_collision_animatable(bool p_enabled);
 	bool is_collision_animatable() const;
 
+	void set_collision_merging_enabled(bool p_enabled);
+	bool is_collision_merging_enabled() const;
+
 	// Debug visibility modes.
 	void set_collision_visibility_mode(VisibilityMode p_show_collision);
 	VisibilityMode get_collision_visibility_mode();
@@ -342,6 +404,7 @@ public:
 	TileMapCell get_cell(int p_layer, const Vector2i &p_coords, bool p_use_proxies = false) const;
 	HashMap<Vector2i, TileMapQuadrant> *get_quadrant_map(int p_layer);
 	int get_effective_quadrant_size(int p_layer) const;
+	void bake_quadrants_rendering(int p_layer); // Fills the quadrants baked rendering data, for tests.
 	//---
 
 	virtual void set_y_sort_enabled(bool p_enable) override;
@@ -311,11 +311,20 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				// Compute all the skin transforms first and upload them in a single call.
+				E->skin_bone_transforms.resize(bind_count);
+				Transform3D *skin_bone_transforms_ptrw = E->skin_bone_transforms.ptrw();
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					if (unlikely(bone_index >= (uint32_t)len)) {
+						// Don't upload whatever a previous update left in this entry.
+						skin_bone_transforms_ptrw[i] = Transform3D();
+						ERR_PRINT("Skin bind #" + itos(i) + " uses bone index " + itos(bone_index) + ", which is greater than the skeleton bone count: " + itos(len) + ".");
+						continue;
+					}
+					skin_bone_transforms_ptrw[i] = bonesptr[bone_index].pose_global * skin->get_bind_pose(i);
 				}
+				rs->skeleton_set_bone_transforms(skeleton, E->skin_bone_transforms);
 			}
 #ifdef TOOLS_ENABLED
 			emit_signal(SceneStringNames::get_singleton()->pose_updated);
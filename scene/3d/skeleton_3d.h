@@ -51,6 +51,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	Vector<Transform3D> skin_bone_transforms;
 	void _skin_changed();
 
 protected:
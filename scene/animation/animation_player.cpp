@@ -246,7 +246,7 @@ void AnimationPlayer::_notification(int p_what) {
 			}
 
 			if (processing) {
-				_animation_process(get_process_delta_time());
+				_animation_process_throttled(get_process_delta_time());
 			}
 		} break;
 
@@ -256,7 +256,7 @@ void AnimationPlayer::_notification(int p_what) {
 			}
 
 			if (processing) {
-				_animation_process(get_physics_process_delta_time());
+				_animation_process_throttled(get_physics_process_delta_time());
 			}
 		} break;
 
@@ -1147,6 +1147,25 @@ void AnimationPlayer::_animation_update_transforms() {
 	cache_update_bezier_size = 0;
 }
 
+void AnimationPlayer::_animation_process_throttled(double p_delta) {
+	if (process_interval > 0.0) {
+		// The interval keeps its phase when restarting, so instances don't line up again.
+		process_interval_elapsed += p_delta;
+		process_interval_pending += p_delta;
+		bool interval_reached = process_interval_elapsed >= process_interval;
+		if (interval_reached) {
+			process_interval_elapsed = Math::fmod(process_interval_elapsed, process_interval);
+		} else if (!process_interval_restart) {
+			return;
+		}
+		// Either the interval elapsed or what was just started must be posed right away.
+		process_interval_restart = false;
+		p_delta = process_interval_pending;
+		process_interval_pending = 0.0;
+	}
+	_animation_process(p_delta);
+}
+
 void AnimationPlayer::_animation_process(double p_delta) {
 	if (playback.current.from) {
 		end_reached = false;
@@ -1609,6 +1628,8 @@ void AnimationPlayer::play(const StringName &p_name, float p_custom_blend, float
 
 	if (get_current_animation() != p_name) {
 		_stop_playing_caches();
+		// Pose the new animation on the next process frame, even if the interval hasn't elapsed yet.
+		process_interval_restart = true;
 	}
 
 	c.current.from = &animation_set[name];
@@ -1871,6 +1892,18 @@ AnimationPlayer::AnimationProcessCallback AnimationPlayer::get_process_callback(
 	return process_callback;
 }
 
+void AnimationPlayer::set_process_interval(double p_interval) {
+	process_interval = MAX(p_interval, 0.0);
+	// Start at a phase derived from the instance ID, so players sharing the same interval don't all update on the
+	// same frame. Unlike a random phase, this doesn't change the sequence of the global random number generator.
+	process_interval_elapsed = hash_one_uint64(uint64_t(get_instance_id())) / double(UINT32_MAX) * process_interval;
+	process_interval_pending = 0.0;
+}
+
+double AnimationPlayer::get_process_interval() const {
+	return process_interval;
+}
+
 void AnimationPlayer::set_method_call_mode(AnimationMethodCallMode p_mode) {
 	method_call_mode = p_mode;
 }
@@ -2096,6 +2129,9 @@ void AnimationPlayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_callback", "mode"), &AnimationPlayer::set_process_callback);
 	ClassDB::bind_method(D_METHOD("get_process_callback"), &AnimationPlayer::get_process_callback);
 
+	ClassDB::bind_method(D_METHOD("set_process_interval", "interval"), &AnimationPlayer::set_process_interval);
+	ClassDB::bind_method(D_METHOD("get_process_interval"), &AnimationPlayer::get_process_interval);
+
 	ClassDB::bind_method(D_METHOD("set_method_call_mode", "mode"), &AnimationPlayer::set_method_call_mode);
 	ClassDB::bind_method(D_METHOD("get_method_call_mode"), &AnimationPlayer::get_method_call_mode);
 
@@ -2115,6 +2151,7 @@ void AnimationPlayer::_bind_methods() {
 
 	ADD_GROUP("Playback Options", "playback_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "playback_process_mode", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_callback", "get_process_callback");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "playback_process_interval", PROPERTY_HINT_RANGE, "0,1,0.001,or_greater"), "set_process_interval", "get_process_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "playback_default_blend_time", PROPERTY_HINT_RANGE, "0,4096,0.01"), "set_default_blend_time", "get_default_blend_time");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "playback_active", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "playback_speed", PROPERTY_HINT_RANGE, "-64,64,0.01"), "set_speed_scale", "get_speed_scale");
@@ -258,6 +258,10 @@ private:
 	String autoplay;
 	bool reset_on_save = true;
 	AnimationProcessCallback process_callback = ANIMATION_PROCESS_IDLE;
+	double process_interval = 0.0;
+	double process_interval_elapsed = 0.0; // Position within the interval, starts at a per-instance phase.
+	double process_interval_pending = 0.0; // Time not applied yet.
+	bool process_interval_restart = false;
 	AnimationMethodCallMode method_call_mode = ANIMATION_METHOD_CALL_DEFERRED;
 	bool processing = false;
 	bool active = true;
@@ -271,6 +275,7 @@ private:
 	void _animation_process2(double p_delta, bool p_started);
 	void _animation_update_transforms();
 	void _animation_process(double p_delta);
+	void _animation_process_throttled(double p_delta);
 
 	void _node_removed(Node *p_node);
 	void _stop_playing_caches();
@@ -365,6 +370,9 @@ public:
 	void set_process_callback(AnimationProcessCallback p_mode);
 	AnimationProcessCallback get_process_callback() const;
 
+	void set_process_interval(double p_interval);
+	double get_process_interval() const;
+
 	void set_method_call_mode(AnimationMethodCallMode p_mode);
 	AnimationMethodCallMode get_method_call_mode() const;
 
@@ -479,6 +479,7 @@ void AnimationTree::set_active(bool p_active) {
 
 	active = p_active;
 	started = active;
+	process_interval_restart = active;
 
 	if (process_callback == ANIMATION_PROCESS_IDLE) {
 		set_process_internal(active);
@@ -522,6 +523,37 @@ AnimationTree::AnimationProcessCallback AnimationTree::get_process_callback() co
 	return process_callback;
 }
 
+void AnimationTree::set_process_interval(double p_interval) {
+	process_interval = MAX(p_interval, 0.0);
+	// Start at a phase derived from the instance ID, so trees sharing the same interval don't all update on the
+	// same frame. Unlike a random phase, this doesn't change the sequence of the global random number generator.
+	process_interval_elapsed = hash_one_uint64(uint64_t(get_instance_id())) / double(UINT32_MAX) * process_interval;
+	process_interval_pending = 0.0;
+}
+
+double AnimationTree::get_process_interval() const {
+	return process_interval;
+}
+
+void AnimationTree::_process_graph_throttled(double p_delta) {
+	if (process_interval > 0.0) {
+		// The interval keeps its phase when restarting, so instances don't line up again.
+		process_interval_elapsed += p_delta;
+		process_interval_pending += p_delta;
+		bool interval_reached = process_interval_elapsed >= process_interval;
+		if (interval_reached) {
+			process_interval_elapsed = Math::fmod(process_interval_elapsed, process_interval);
+		} else if (!process_interval_restart) {
+			return;
+		}
+		// Either the interval elapsed or what was just started must be posed right away.
+		process_interval_restart = false;
+		p_delta = process_interval_pending;
+		process_interval_pending = 0.0;
+	}
+	_process_graph(p_delta);
+}
+
 void AnimationTree::_node_removed(Node *p_node) {
 	cache_valid = false;
 }
@@ -817,10 +849,14 @@ bool AnimationTree::_update_caches(AnimationPlayer *player) {
 	}
 
 	state.track_map.clear();
+	track_cache_list.clear();
+	track_cache_list.reserve(track_cache.size());
 
 	int idx = 0;
 	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
 		state.track_map[K.key] = idx;
+		K.value->blend_idx = idx;
+		track_cache_list.push_back(K.value);
 		idx++;
 	}
 
@@ -838,6 +874,7 @@ void AnimationTree::_clear_caches() {
 	playing_caches.clear();
 
 	track_cache.clear();
+	track_cache_list.clear();
 	cache_valid = false;
 }
 
@@ -912,6 +949,9 @@ void AnimationTree::_process_graph(double p_delta) {
 		}
 	}
 
+	// Animation states only live until the next pass, allocate them from the frame arena.
+	FrameArena::Scope frame_arena_scope(&frame_arena);
+
 	{ //setup
 
 		process_pass++;
@@ -919,6 +959,7 @@ void AnimationTree::_process_graph(double p_delta) {
 		state.valid = true;
 		state.invalid_reasons = "";
 		state.animation_states.clear(); //will need to be re-created
+		frame_arena.reset();
 		state.valid = true;
 		state.player = player;
 		state.last_pass = process_pass;
@@ -968,9 +1009,10 @@ void AnimationTree::_process_graph(double p_delta) {
 			for (int i = 0; i < a->get_track_count(); i++) {
 				NodePath path = a->track_get_path(i);
 
-				ERR_CONTINUE(!track_cache.has(path));
+				TrackCache **track_ptr = track_cache.getptr(path);
+				ERR_CONTINUE(!track_ptr);
 
-				TrackCache *track = track_cache[path];
+				TrackCache *track = *track_ptr;
 
 				Animation::TrackType ttype = a->track_get_type(i);
 				if (ttype != Animation::TYPE_POSITION_3D && ttype != Animation::TYPE_ROTATION_3D && ttype != Animation::TYPE_SCALE_3D && track->type != ttype) {
@@ -980,8 +1022,7 @@ void AnimationTree::_process_graph(double p_delta) {
 
 				track->root_motion = root_motion_track == path;
 
-				ERR_CONTINUE(!state.track_map.has(path));
-				int blend_idx = state.track_map[path];
+				int blend_idx = track->blend_idx;
 
 				ERR_CONTINUE(blend_idx < 0 || blend_idx >= state.track_count);
 
@@ -1564,8 +1605,8 @@ void AnimationTree::_process_graph(double p_delta) {
 
 	{
 		// finally, set the tracks
-		for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
-			TrackCache *track = K.value;
+		for (uint32_t i = 0; i < track_cache_list.size(); i++) {
+			TrackCache *track = track_cache_list[i];
 			if (track->process_pass != process_pass) {
 				continue; //not processed, ignore
 			}
@@ -1661,13 +1702,13 @@ void AnimationTree::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && process_callback == ANIMATION_PROCESS_IDLE) {
-				_process_graph(get_process_delta_time());
+				_process_graph_throttled(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && process_callback == ANIMATION_PROCESS_PHYSICS) {
-				_process_graph(get_physics_process_delta_time());
+				_process_graph_throttled(get_physics_process_delta_time());
 			}
 		} break;
 	}
@@ -1874,6 +1915,9 @@ void AnimationTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_callback", "mode"), &AnimationTree::set_process_callback);
 	ClassDB::bind_method(D_METHOD("get_process_callback"), &AnimationTree::get_process_callback);
 
+	ClassDB::bind_method(D_METHOD("set_process_interval", "interval"), &AnimationTree::set_process_interval);
+	ClassDB::bind_method(D_METHOD("get_process_interval"), &AnimationTree::get_process_interval);
+
 	ClassDB::bind_method(D_METHOD("set_animation_player", "root"), &AnimationTree::set_animation_player);
 	ClassDB::bind_method(D_METHOD("get_animation_player"), &AnimationTree::get_animation_player);
 
@@ -1892,6 +1936,7 @@ void AnimationTree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "anim_player", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "AnimationPlayer"), "set_animation_player", "get_animation_player");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_callback", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_callback", "get_process_callback");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "process_interval", PROPERTY_HINT_RANGE, "0,1,0.001,or_greater"), "set_process_interval", "get_process_interval");
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 
@@ -32,6 +32,8 @@
 #define ANIMATION_GRAPH_PLAYER_H
 
 #include "animation_player.h"
+#include "core/templates/frame_arena.h"
+#include "core/templates/local_vector.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/animation.h"
@@ -75,7 +77,7 @@ public:
 	struct State {
 		int track_count = 0;
 		HashMap<NodePath, int> track_map;
-		List<AnimationState> animation_states;
+		List<AnimationState, FrameArenaAllocator> animation_states;
 		bool valid = false;
 		AnimationPlayer *player = nullptr;
 		AnimationTree *tree = nullptr;
@@ -188,6 +190,7 @@ public:
 private:
 	struct TrackCache {
 		bool root_motion = false;
+		int blend_idx = -1;
 		uint64_t setup_pass = 0;
 		uint64_t process_pass = 0;
 		Animation::TrackType type = Animation::TrackType::TYPE_ANIMATION;
@@ -267,14 +270,20 @@ private:
 	};
 
 	HashMap<NodePath, TrackCache *> track_cache;
+	LocalVector<TrackCache *> track_cache_list; // Same caches as track_cache, indexed by blend index.
 	HashSet<TrackCache *> playing_caches;
 
 	Ref<AnimationNode> root;
 
 	AnimationProcessCallback process_callback = ANIMATION_PROCESS_IDLE;
+	double process_interval = 0.0;
+	double process_interval_elapsed = 0.0; // Position within the interval, starts at a per-instance phase.
+	double process_interval_pending = 0.0; // Time not applied yet.
+	bool process_interval_restart = false;
 	bool active = false;
 	NodePath animation_player;
 
+	FrameArena frame_arena; // Must outlive state, which allocates from it.
 	AnimationNode::State state;
 	bool cache_valid = false;
 	void _node_removed(Node *p_node);
@@ -282,6 +291,7 @@ private:
 	void _clear_caches();
 	bool _update_caches(AnimationPlayer *player);
 	void _process_graph(double p_delta);
+	void _process_graph_throttled(double p_delta);
 
 	uint64_t setup_pass = 1;
 	uint64_t process_pass = 1;
@@ -329,6 +339,9 @@ public:
 	void set_process_callback(AnimationProcessCallback p_mode);
 	AnimationProcessCallback get_process_callback() const;
 
+	void set_process_interval(double p_interval);
+	double get_process_interval() const;
+
 	void set_animation_player(const NodePath &p_player);
 	NodePath get_animation_player() const;
 
@@ -30,6 +30,7 @@
 
 #include "scene_replication_interface.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
 #include "scene/main/node.h"
 #include "scene/multiplayer/multiplayer_spawner.h"
@@ -43,6 +44,12 @@ MultiplayerReplicationInterface *SceneReplicationInterface::_create(MultiplayerA
 	return memnew(SceneReplicationInterface(p_multiplayer));
 }
 
+SceneReplicationInterface::SceneReplicationInterface(MultiplayerAPI *p_multiplayer) {
+	rep_state.instantiate();
+	multiplayer = p_multiplayer;
+	sync_budget = GLOBAL_GET("network/limits/scene_replication/max_sync_bytes_per_peer");
+}
+
 void SceneReplicationInterface::make_default() {
 	MultiplayerAPI::create_default_replication_interface = _create;
 }
@@ -88,6 +95,7 @@ void SceneReplicationInterface::on_network_process() {
 	for (int peer : rep_state->get_peers()) {
 		_send_sync(peer, msec);
 	}
+	sync_state_cache.clear();
 }
 
 Error SceneReplicationInterface::on_spawn(Object *p_obj, Variant p_config) {
@@ -325,26 +333,47 @@ void SceneReplicationInterface::_send_sync(int p_peer, uint64_t p_msec) {
 	ptr[0] = MultiplayerAPI::NETWORK_COMMAND_SYNC;
 	int ofs = 1;
 	ofs += encode_uint16(rep_state->peer_sync_next(p_peer), &ptr[1]);
+	// Nodes which didn't fit in the budget of the previous network process go first, so they can't starve.
+	const HashSet<ObjectID> &pending = rep_state->peer_get_sync_pending(p_peer);
+	sync_queue.clear();
+	for (const ObjectID &oid : pending) {
+		sync_queue.push_back(oid);
+	}
+	const uint32_t pending_count = sync_queue.size();
 	// Can only send updates for already notified nodes.
 	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
 	for (const ObjectID &oid : known) {
-		if (!rep_state->update_sync_time(oid, p_msec)) {
-			continue; // nothing to sync.
+		if (!rep_state->update_sync_time(oid, p_msec) || pending.has(oid)) {
+			continue; // nothing to sync, or already queued.
+		}
+		sync_queue.push_back(oid);
+	}
+	int sent = 0;
+	for (uint32_t i = 0; i < sync_queue.size(); i++) {
+		const ObjectID oid = sync_queue[i];
+		if (i < pending_count) {
+			rep_state->peer_set_sync_pending(p_peer, oid, false);
+			if (!known.has(oid)) {
+				continue;
+			}
 		}
 		MultiplayerSynchronizer *sync = rep_state->get_synchronizer(oid);
 		ERR_CONTINUE(!sync);
 		Node *node = rep_state->get_node(oid);
 		ERR_CONTINUE(!node);
-		int size;
-		Vector<Variant> vars;
-		Vector<const Variant *> varp;
-		const List<NodePath> props = sync->get_replication_config()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
-		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		const PackedByteArray *state = _get_sync_state(oid, sync, node);
+		if (!state) {
+			continue; // Already reported.
+		}
+		int size = state->size();
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > 3 + 4 + 4 + sync_mtu, vformat("Node states bigger then MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (sync_budget > 0 && sent > 0 && sent + size > sync_budget) {
+			// Out of budget for this peer, try again on the next network process.
+			rep_state->peer_set_sync_pending(p_peer, oid, true);
+			continue;
+		}
+		sent += size;
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
@@ -363,7 +392,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, uint64_t p_msec) {
 			}
 			ofs += encode_uint32(rep_state->get_net_id(oid), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], state->ptr(), size);
 			ofs += size;
 		}
 	}
@@ -373,6 +402,28 @@ void SceneReplicationInterface::_send_sync(int p_peer, uint64_t p_msec) {
 	}
 }
 
+const PackedByteArray *SceneReplicationInterface::_get_sync_state(const ObjectID &p_oid, MultiplayerSynchronizer *p_sync, Node *p_node) {
+	// The state is the same for every peer, so only gather and encode it once per network process.
+	const PackedByteArray *cached = sync_state_cache.getptr(p_oid);
+	if (cached) {
+		return cached;
+	}
+	Vector<Variant> vars;
+	Vector<const Variant *> varp;
+	const List<NodePath> props = p_sync->get_replication_config()->get_sync_properties();
+	Error err = MultiplayerSynchronizer::get_state(props, p_node, vars, varp);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to retrieve sync state.");
+	int size;
+	err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to encode sync state.");
+	PackedByteArray &state = sync_state_cache[p_oid];
+	state.resize(size);
+	if (size) {
+		MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), state.ptrw(), size);
+	}
+	return &state;
+}
+
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
 	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
 	uint16_t time = decode_uint16(&p_buffer[1]);
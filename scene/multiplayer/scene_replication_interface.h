@@ -32,6 +32,7 @@
 #define SCENE_TREE_REPLICATOR_INTERFACE_H
 
 #include "core/multiplayer/multiplayer_api.h"
+#include "core/templates/local_vector.h"
 
 #include "scene/multiplayer/scene_replication_state.h"
 
@@ -40,6 +41,7 @@ class SceneReplicationInterface : public MultiplayerReplicationInterface {
 
 private:
 	void _send_sync(int p_peer, uint64_t p_msec);
+	const PackedByteArray *_get_sync_state(const ObjectID &p_oid, MultiplayerSynchronizer *p_sync, Node *p_node);
 	Error _send_spawn(Node *p_node, MultiplayerSpawner *p_spawner, int p_peer);
 	Error _send_despawn(Node *p_node, int p_peer);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
@@ -49,7 +51,10 @@ private:
 	Ref<SceneReplicationState> rep_state;
 	MultiplayerAPI *multiplayer = nullptr;
 	PackedByteArray packet_cache;
+	HashMap<ObjectID, PackedByteArray> sync_state_cache; // Encoded sync states of the current network process, shared by all peers.
+	LocalVector<ObjectID> sync_queue;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
+	int sync_budget = 0; // Maximum state bytes sent to each peer per network process, 0 means unlimited.
 
 	// An hack to apply the initial state before ready.
 	ObjectID pending_spawn;
@@ -75,10 +80,7 @@ public:
 	virtual Error on_despawn_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) override;
 	virtual Error on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) override;
 
-	SceneReplicationInterface(MultiplayerAPI *p_multiplayer) {
-		rep_state.instantiate();
-		multiplayer = p_multiplayer;
-	}
+	SceneReplicationInterface(MultiplayerAPI *p_multiplayer);
 };
 
 #endif // SCENE_TREE_REPLICATOR_INTERFACE_H
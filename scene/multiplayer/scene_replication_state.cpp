@@ -93,9 +93,11 @@ bool SceneReplicationState::update_sync_time(const ObjectID &p_id, uint64_t p_ms
 	return false;
 }
 
-const HashSet<ObjectID> SceneReplicationState::get_known_nodes(int p_peer) {
-	ERR_FAIL_COND_V(!peers_info.has(p_peer), HashSet<ObjectID>());
-	return peers_info[p_peer].known_nodes;
+const HashSet<ObjectID> &SceneReplicationState::get_known_nodes(int p_peer) {
+	static const HashSet<ObjectID> empty;
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND_V(!info, empty);
+	return info->known_nodes;
 }
 
 uint32_t SceneReplicationState::get_net_id(const ObjectID &p_id) const {
@@ -204,9 +206,11 @@ Error SceneReplicationState::peer_del_node(int p_peer, const ObjectID &p_id) {
 	if (p_peer) {
 		ERR_FAIL_COND_V(!peers_info.has(p_peer), ERR_INVALID_PARAMETER);
 		peers_info[p_peer].known_nodes.erase(p_id);
+		peers_info[p_peer].sync_pending.erase(p_id);
 	} else {
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
 			E.value.known_nodes.erase(p_id);
+			E.value.sync_pending.erase(p_id);
 		}
 	}
 	return OK;
@@ -252,3 +256,20 @@ void SceneReplicationState::peer_sync_recv(int p_peer, uint16_t p_time) {
 	ERR_FAIL_COND(!peers_info.has(p_peer));
 	peers_info[p_peer].last_recv_sync = p_time;
 }
+
+const HashSet<ObjectID> &SceneReplicationState::peer_get_sync_pending(int p_peer) {
+	static const HashSet<ObjectID> empty;
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND_V(!info, empty);
+	return info->sync_pending;
+}
+
+void SceneReplicationState::peer_set_sync_pending(int p_peer, const ObjectID &p_id, bool p_pending) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND(!info);
+	if (p_pending) {
+		info->sync_pending.insert(p_id);
+	} else {
+		info->sync_pending.erase(p_id);
+	}
+}
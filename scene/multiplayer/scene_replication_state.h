@@ -63,6 +63,7 @@ private:
 
 	struct PeerInfo {
 		HashSet<ObjectID> known_nodes;
+		HashSet<ObjectID> sync_pending; // Nodes due for sync which didn't fit in the previous sync budget.
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
 		uint16_t last_recv_sync = 0;
@@ -90,7 +91,7 @@ public:
 	bool update_last_node_sync(const ObjectID &p_id, uint16_t p_time);
 	bool update_sync_time(const ObjectID &p_id, uint64_t p_msec);
 
-	const HashSet<ObjectID> get_known_nodes(int p_peer);
+	const HashSet<ObjectID> &get_known_nodes(int p_peer);
 	uint32_t get_net_id(const ObjectID &p_id) const;
 	void set_net_id(const ObjectID &p_id, uint32_t p_net_id);
 	uint32_t ensure_net_id(const ObjectID &p_id);
@@ -115,6 +116,9 @@ public:
 	uint16_t peer_sync_next(int p_peer);
 	void peer_sync_recv(int p_peer, uint16_t p_time);
 
+	const HashSet<ObjectID> &peer_get_sync_pending(int p_peer);
+	void peer_set_sync_pending(int p_peer, const ObjectID &p_id, bool p_pending);
+
 	SceneReplicationState() {}
 };
 
@@ -261,29 +261,67 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 		p_offset += 1;
 	}
 
-	Vector<Variant> args;
-	Vector<const Variant *> argp;
-	args.resize(argc);
-	argp.resize(argc);
+	// At most 255 arguments, so they are decoded on the stack.
+	Variant *args = (Variant *)alloca(sizeof(Variant) * argc);
+	const Variant **argp = (const Variant **)alloca(sizeof(const Variant *) * argc);
+	for (int i = 0; i < argc; i++) {
+		memnew_placement(&args[i], Variant);
+		argp[i] = &args[i];
+	}
 
 #ifdef DEBUG_ENABLED
 	_profile_node_data("rpc_in", p_node->get_instance_id());
 #endif
 
 	int out;
-	MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
-	for (int i = 0; i < argc; i++) {
-		argp.write[i] = &args[i];
-	}
+	MultiplayerAPI::decode_and_decompress_variants(args, argc, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
 
 	Callable::CallError ce;
 
-	p_node->callp(config.name, (const Variant **)argp.ptr(), argc, ce);
+	p_node->callp(config.name, argp, argc, ce);
 	if (ce.error != Callable::CallError::CALL_OK) {
-		String error = Variant::get_call_error_text(p_node, config.name, (const Variant **)argp.ptr(), argc, ce);
+		String error = Variant::get_call_error_text(p_node, config.name, argp, argc, ce);
 		error = "RPC - " + error;
 		ERR_PRINT(error);
 	}
+
+	for (int i = 0; i < argc; i++) {
+		args[i].~Variant();
+	}
+}
+
+SceneRPCInterface::RelativePath &SceneRPCInterface::_get_relative_path(Node *p_node) {
+	// Building the relative path allocates, so it is kept until the node or the multiplayer root moves.
+	const NodePath root_path = multiplayer->get_root_path();
+	const NodePath node_path = p_node->get_path();
+
+	RelativePath *cached = relative_path_cache.getptr(p_node->get_instance_id());
+	if (cached && cached->node_path == node_path && cached->root_path == root_path) {
+		return *cached;
+	}
+
+	if (!cached) {
+		if (relative_path_cache.size() >= relative_path_cache_prune_size) {
+			// Forget the nodes that were freed since the last time.
+			LocalVector<ObjectID> freed;
+			for (const KeyValue<ObjectID, RelativePath> &E : relative_path_cache) {
+				if (!ObjectDB::get_instance(E.key)) {
+					freed.push_back(E.key);
+				}
+			}
+			for (uint32_t i = 0; i < freed.size(); i++) {
+				relative_path_cache.erase(freed[i]);
+			}
+			relative_path_cache_prune_size = MAX(relative_path_cache.size() * 2, 64u);
+		}
+		cached = &relative_path_cache.insert(p_node->get_instance_id(), RelativePath())->value;
+	}
+
+	cached->root_path = root_path;
+	cached->node_path = node_path;
+	cached->path = root_path.rel_path_to(node_path);
+	cached->path_utf8 = CharString();
+	return *cached;
 }
 
 void SceneRPCInterface::_send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, const Multiplayer::RPCConfig &p_config, const StringName &p_name, const Variant **p_arg, int p_argcount) {
@@ -302,7 +340,8 @@ void SceneRPCInterface::_send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, con
 		ERR_FAIL_MSG("Attempt to call RPC with unknown peer ID: " + itos(p_to) + ".");
 	}
 
-	NodePath from_path = multiplayer->get_root_path().rel_path_to(p_from->get_path());
+	RelativePath &relative_path = _get_relative_path(p_from);
+	const NodePath &from_path = relative_path.path;
 	ERR_FAIL_COND_MSG(from_path.is_empty(), "Unable to send RPC. Relative path is empty. THIS IS LIKELY A BUG IN THE ENGINE!");
 
 	// See if all peers have cached path (if so, call can be fast).
@@ -414,7 +453,10 @@ void SceneRPCInterface::_send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, con
 		// Not all verified path, so send one by one.
 
 		// Append path at the end, since we will need it for some packets.
-		CharString pname = String(from_path).utf8();
+		if (relative_path.path_utf8.size() == 0) {
+			relative_path.path_utf8 = String(from_path).utf8();
+		}
+		const CharString &pname = relative_path.path_utf8;
 		int path_len = encode_cstring(pname.get_data(), nullptr);
 		MAKE_ROOM(ofs + path_len);
 		encode_cstring(pname.get_data(), &(packet_cache.write[ofs]));
@@ -33,6 +33,7 @@
 
 #include "core/multiplayer/multiplayer.h"
 #include "core/multiplayer/multiplayer_api.h"
+#include "core/templates/hash_map.h"
 
 class SceneRPCInterface : public MultiplayerRPCInterface {
 	GDCLASS(SceneRPCInterface, MultiplayerRPCInterface);
@@ -66,8 +67,18 @@ private:
 		BYTE_ONLY_OR_NO_ARGS_FLAG = (1 << BYTE_ONLY_OR_NO_ARGS_SHIFT),
 	};
 
+	// Path of a node relative to the multiplayer root, as sent to the peers that don't know its ID yet.
+	struct RelativePath {
+		NodePath root_path;
+		NodePath node_path;
+		NodePath path;
+		CharString path_utf8; // Only built when a peer needs the full path.
+	};
+
 	MultiplayerAPI *multiplayer = nullptr;
 	Vector<uint8_t> packet_cache;
+	HashMap<ObjectID, RelativePath> relative_path_cache;
+	uint32_t relative_path_cache_prune_size = 64;
 
 protected:
 	static MultiplayerRPCInterface *_create(MultiplayerAPI *p_multiplayer);
@@ -77,6 +88,7 @@ protected:
 
 	void _send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, const Multiplayer::RPCConfig &p_config, const StringName &p_name, const Variant **p_arg, int p_argcount);
 	Node *_process_get_node(int p_from, const uint8_t *p_packet, uint32_t p_node_target, int p_packet_len);
+	RelativePath &_get_relative_path(Node *p_node);
 
 public:
 	static void make_default();
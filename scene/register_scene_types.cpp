@@ -1093,6 +1093,8 @@ void register_scene_types() {
 	}
 
 	SceneDebugger::initialize();
+	GLOBAL_DEF("network/limits/scene_replication/max_sync_bytes_per_peer", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("network/limits/scene_replication/max_sync_bytes_per_peer", PropertyInfo(Variant::INT, "network/limits/scene_replication/max_sync_bytes_per_peer", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"));
 	SceneReplicationInterface::make_default();
 	SceneRPCInterface::make_default();
 	SceneCacheInterface::make_default();
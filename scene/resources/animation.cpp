@@ -5005,12 +5005,20 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
+	// Pages are sorted by time offset, so binary search for the last page starting at or before p_time.
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	{
+		uint32_t low = 0;
+		uint32_t high = compression.pages.size();
+		while (low < high) {
+			uint32_t middle = (low + high) / 2;
+			if (compression.pages[middle].time_offset > p_time) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
 		}
-		page_index = i;
+		page_index = int32_t(low) - 1;
 	}
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
@@ -5028,21 +5036,39 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
+	if (key_index) {
+		// Key indices are accumulated from the start of the page, so all packets have to be visited.
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			uint32_t f = time_keys[i * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
 
-		if (frame_time > p_time) {
-			break;
-		}
+			if (frame_time > p_time) {
+				break;
+			}
 
-		if (key_index) {
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
-		}
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+			packet_idx = i;
+			packet_time = frame_time;
+			base_frame = f;
+		}
+	} else if (time_key_count > 1) {
+		// Packets are sorted by frame, so binary search for the last one starting at or before p_time.
+		uint32_t low = 1;
+		uint32_t high = time_key_count;
+		while (low < high) {
+			uint32_t middle = (low + high) / 2;
+			if (double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
+		}
+		if (low > 1) {
+			packet_idx = low - 1;
+			base_frame = time_keys[packet_idx * 2 + 0];
+			packet_time = double(base_frame) * frame_to_sec + page_base_time;
+		}
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
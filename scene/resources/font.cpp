@@ -1882,8 +1882,17 @@ Dictionary FontData::get_supported_variation_list() const {
 	return TS->font_supported_variation_list(cache[0]);
 }
 
+void FontData::_font_size_cache_evicted(const RID &p_font_rid) {
+	if (cache.has(p_font_rid)) {
+		// The glyph textures used by text drawn with this font were freed.
+		emit_changed();
+	}
+}
+
 FontData::FontData() {
-	/* NOP */
+	if (TextServerManager::get_singleton() && TS.is_valid()) {
+		TS->connect(SNAME("font_size_cache_evicted"), callable_mp(this, &FontData::_font_size_cache_evicted));
+	}
 }
 
 FontData::~FontData() {
@@ -83,6 +83,14 @@ int AudioStreamPlayback::mix(AudioFrame *p_buffer, float p_rate_scale, int p_fra
 	return 0;
 }
 
+int AudioStreamPlayback::skip(float p_rate_scale, int p_frames) {
+	return -1;
+}
+
+bool AudioStreamPlayback::can_skip() const {
+	return false;
+}
+
 void AudioStreamPlayback::_bind_methods() {
 	GDVIRTUAL_BIND(_start, "from_pos")
 	GDVIRTUAL_BIND(_stop)
@@ -101,8 +109,157 @@ void AudioStreamPlaybackResampled::begin_resample() {
 	internal_buffer[2] = AudioFrame(0.0, 0.0);
 	internal_buffer[3] = AudioFrame(0.0, 0.0);
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_read_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
+	resample_pending = false;
+}
+
+int AudioStreamPlaybackResampled::_read_internal(AudioFrame *p_buffer, int p_frames) {
+	if (!decode_ahead_active.is_set()) {
+		return _mix_internal(p_buffer, p_frames);
+	}
+
+	uint32_t seek_done = decode_ahead_seek_done.get();
+	if (seek_done != decode_ahead_seek_requested.get()) {
+		// Frames buffered from before the seek must not be heard, wait for the new ones.
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+		return p_frames;
+	}
+	if (seek_done != decode_ahead_seek_applied) {
+		decode_ahead_read_pos.set(decode_ahead_seek_start.get());
+		decode_ahead_seek_applied = seek_done;
+	}
+
+	// Check for the end before reading, so frames written right before it are not missed.
+	bool ended = decode_ahead_ended.is_set();
+	uint32_t read_pos = decode_ahead_read_pos.get();
+	int read = MIN(p_frames, int(decode_ahead_write_pos.get() - read_pos));
+	for (int i = 0; i < read; i++) {
+		p_buffer[i] = decode_ahead_buffer[(read_pos + i) & decode_ahead_mask];
+	}
+	for (int i = read; i < p_frames; i++) {
+		p_buffer[i] = AudioFrame(0, 0);
+	}
+	// Hands the space back to the decode-ahead thread only once the frames are copied.
+	decode_ahead_read_pos.set(read_pos + read);
+	if (AudioStreamDecodeAhead::get_singleton()) {
+		AudioStreamDecodeAhead::get_singleton()->request_decode();
+	}
+
+	if (read < p_frames && !ended) {
+		// Underrun, the decoder couldn't keep up. Output silence but keep playing.
+		return p_frames;
+	}
+	return read;
+}
+
+bool AudioStreamPlaybackResampled::_decode_ahead_chunk() {
+	uint32_t seek_requested = decode_ahead_seek_requested.get();
+	if (seek_requested != decode_ahead_seek_done.get()) {
+		_seek_internal(decode_ahead_seek_time.get());
+		decode_ahead_ended.clear();
+		// The audio thread isn't reading until the seek is done, and then skips to what is written from here.
+		decode_ahead_seek_start.set(decode_ahead_write_pos.get());
+		decode_ahead_seek_done.set(seek_requested);
+	}
+
+	if (decode_ahead_ended.is_set()) {
+		return false;
+	}
+
+	uint32_t write_pos = decode_ahead_write_pos.get();
+	uint32_t space = decode_ahead_buffer.size() - (write_pos - decode_ahead_read_pos.get());
+	if (space < INTERNAL_BUFFER_LEN) {
+		return false;
+	}
+
+	AudioFrame chunk[INTERNAL_BUFFER_LEN];
+	int mixed = _mix_internal(chunk, INTERNAL_BUFFER_LEN);
+	for (int i = 0; i < mixed; i++) {
+		decode_ahead_buffer[(write_pos + i) & decode_ahead_mask] = chunk[i];
+	}
+	// Publishes the frames to the audio thread only once they are written.
+	decode_ahead_write_pos.set(write_pos + mixed);
+	if (mixed < INTERNAL_BUFFER_LEN) {
+		decode_ahead_ended.set();
+		return false;
+	}
+	return true;
+}
+
+void AudioStreamPlaybackResampled::begin_decode_ahead() {
+	AudioStreamDecodeAhead *decode_ahead = AudioStreamDecodeAhead::get_singleton();
+	if (!decode_ahead || !decode_ahead->is_enabled() || decode_ahead_stream || !is_playing()) {
+		return;
+	}
+
+	int frames = decode_ahead->get_buffer_frames(get_stream_sampling_rate());
+	int shift = nearest_shift(frames);
+	int64_t bytes = int64_t(sizeof(AudioFrame)) << shift;
+	if (!decode_ahead->reserve(bytes)) {
+		// Over budget, keep decoding on the audio thread.
+		return;
+	}
+	decode_ahead_bytes = bytes;
+
+	decode_ahead_buffer.resize(1 << shift);
+	decode_ahead_mask = (1 << shift) - 1;
+	decode_ahead_write_pos.set(0);
+	decode_ahead_read_pos.set(0);
+	decode_ahead_ended.clear();
+	decode_ahead_seek_requested.set(0);
+	decode_ahead_seek_done.set(0);
+	decode_ahead_seek_applied = 0;
+
+	// begin_resample() already decoded the first chunk, the decode-ahead thread fills the rest
+	// while it's being mixed. Nothing is decoded here, so starting a playback stays cheap.
+	decode_ahead_active.set();
+	decode_ahead_stream = decode_ahead->add_playback(this);
+	decode_ahead->request_decode();
+}
+
+void AudioStreamPlaybackResampled::end_decode_ahead() {
+	if (!decode_ahead_stream) {
+		return;
+	}
+
+	AudioStreamDecodeAhead *decode_ahead = AudioStreamDecodeAhead::get_singleton();
+	if (decode_ahead) {
+		// Only waits for the chunk being decoded for this playback, if any.
+		decode_ahead->remove_playback(decode_ahead_stream);
+		decode_ahead->release(decode_ahead_bytes);
+	} else if (decode_ahead_stream->refcount.unref()) {
+		// The decode-ahead thread is gone already, so it doesn't reference the stream anymore.
+		memdelete(decode_ahead_stream);
+	}
+	decode_ahead_stream = nullptr;
+	decode_ahead_bytes = 0;
+	decode_ahead_active.clear();
+}
+
+void AudioStreamPlaybackResampled::request_decode_ahead_seek(float p_time) {
+	ERR_FAIL_COND(!decode_ahead_active.is_set());
+	decode_ahead_seek_time.set(p_time);
+	// Publishes the time along with the request.
+	decode_ahead_seek_requested.increment();
+	if (AudioStreamDecodeAhead::get_singleton()) {
+		AudioStreamDecodeAhead::get_singleton()->request_decode();
+	}
+}
+
+bool AudioStreamPlaybackResampled::is_decode_ahead_drained() const {
+	if (decode_ahead_seek_done.get() != decode_ahead_seek_requested.get()) {
+		// Seeking restarts a decoder that reached the end.
+		return false;
+	}
+	// Check for the end first, all frames are written by then.
+	return decode_ahead_ended.is_set() && get_decode_ahead_frames() == 0;
+}
+
+int AudioStreamPlaybackResampled::get_decode_ahead_frames() const {
+	return decode_ahead_active.is_set() ? int(decode_ahead_write_pos.get() - decode_ahead_read_pos.get()) : 0;
 }
 
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
@@ -113,6 +270,18 @@ int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_fram
 
 	return 0;
 }
+
+int AudioStreamPlaybackResampled::_skip_internal(int p_frames) {
+	return -1;
+}
+
+bool AudioStreamPlaybackResampled::_can_skip_internal() const {
+	return false;
+}
+
+void AudioStreamPlaybackResampled::_seek_internal(float p_time) {
+}
+
 float AudioStreamPlaybackResampled::get_stream_sampling_rate() {
 	float ret;
 	if (GDVIRTUAL_REQUIRED_CALL(_get_stream_sampling_rate, ret)) {
@@ -135,6 +304,11 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
 
+	if (resample_pending) {
+		// The stream was skipped ahead, refill the internal buffer from the new position.
+		begin_resample();
+	}
+
 	int mixed_frames_total = p_frames;
 
 	for (int i = 0; i < p_frames; i++) {
@@ -167,8 +341,8 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
 			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
 			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			if (is_playing()) {
-				int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			if (decode_ahead_active.is_set() || is_playing()) {
+				int mixed_frames = _read_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 				if (mixed_frames != INTERNAL_BUFFER_LEN) {
 					// internal_buffer[mixed_frames] is the first frame of silence.
 					internal_buffer_end = mixed_frames;
@@ -188,6 +362,165 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 	return mixed_frames_total;
 }
 
+int AudioStreamPlaybackResampled::skip(float p_rate_scale, int p_frames) {
+	if (decode_ahead_active.is_set()) {
+		// The decoder belongs to the decode-ahead thread.
+		return -1;
+	}
+
+	float target_rate = AudioServer::get_singleton()->get_mix_rate();
+	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
+
+	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
+
+	// Keep the fractional part of the position so consecutive skips don't drift.
+	uint64_t offset = (mix_offset & FP_MASK) + mix_increment * uint64_t(p_frames);
+	int stream_frames = int(offset >> FP_BITS);
+
+	int skipped = _skip_internal(stream_frames);
+	if (skipped < 0) {
+		return -1;
+	}
+
+	mix_offset = offset & FP_MASK;
+	resample_pending = true;
+
+	if (skipped < stream_frames) {
+		return int(int64_t(p_frames) * skipped / stream_frames);
+	}
+	return p_frames;
+}
+
+bool AudioStreamPlaybackResampled::can_skip() const {
+	// The decoder belongs to the decode-ahead thread while it is active.
+	return !decode_ahead_active.is_set() && _can_skip_internal();
+}
+
+AudioStreamPlaybackResampled::~AudioStreamPlaybackResampled() {
+	end_decode_ahead();
+}
+
+////////////////////////////////
+
+AudioStreamDecodeAhead *AudioStreamDecodeAhead::singleton = nullptr;
+
+void AudioStreamDecodeAhead::_thread_func(void *p_userdata) {
+	AudioStreamDecodeAhead *decode_ahead = static_cast<AudioStreamDecodeAhead *>(p_userdata);
+	LocalVector<Stream *> to_decode;
+	while (true) {
+		decode_ahead->semaphore.wait();
+		if (decode_ahead->exit_thread.is_set()) {
+			break;
+		}
+
+		// Only hold the registry lock to copy it, playbacks can be added and removed while decoding.
+		{
+			MutexLock lock(decode_ahead->mutex);
+			to_decode.clear();
+			for (uint32_t i = 0; i < decode_ahead->streams.size(); i++) {
+				decode_ahead->streams[i]->refcount.ref();
+				to_decode.push_back(decode_ahead->streams[i]);
+			}
+		}
+
+		for (uint32_t i = 0; i < to_decode.size(); i++) {
+			Stream *stream = to_decode[i];
+			while (true) {
+				// Locked per chunk, so a playback detaching itself waits for one chunk at most.
+				MutexLock lock(stream->mutex);
+				if (!stream->playback || !stream->playback->_decode_ahead_chunk()) {
+					break;
+				}
+			}
+			_unref_stream(stream);
+		}
+	}
+}
+
+void AudioStreamDecodeAhead::_unref_stream(Stream *p_stream) {
+	if (p_stream->refcount.unref()) {
+		memdelete(p_stream);
+	}
+}
+
+int AudioStreamDecodeAhead::get_buffer_frames(float p_sampling_rate) const {
+	return MAX(int(buffer_length * p_sampling_rate), 1024);
+}
+
+bool AudioStreamDecodeAhead::reserve(int64_t p_bytes) {
+	MutexLock lock(mutex);
+	if (memory_used + p_bytes > memory_budget) {
+		return false;
+	}
+	memory_used += p_bytes;
+	return true;
+}
+
+void AudioStreamDecodeAhead::release(int64_t p_bytes) {
+	MutexLock lock(mutex);
+	memory_used -= p_bytes;
+}
+
+int64_t AudioStreamDecodeAhead::get_memory_used() const {
+	MutexLock lock(mutex);
+	return memory_used;
+}
+
+AudioStreamDecodeAhead::Stream *AudioStreamDecodeAhead::add_playback(AudioStreamPlaybackResampled *p_playback) {
+	Stream *stream = memnew(Stream);
+	stream->refcount.init(2); // Referenced by the playback and the registry.
+	stream->playback = p_playback;
+
+	MutexLock lock(mutex);
+	streams.push_back(stream);
+	return stream;
+}
+
+void AudioStreamDecodeAhead::remove_playback(Stream *p_stream) {
+	{
+		MutexLock lock(mutex);
+		streams.erase(p_stream);
+	}
+	_unref_stream(p_stream);
+
+	{
+		// The decode-ahead thread may still reference the stream, but won't touch the playback after this.
+		MutexLock lock(p_stream->mutex);
+		p_stream->playback = nullptr;
+	}
+	_unref_stream(p_stream);
+}
+
+AudioStreamDecodeAhead::AudioStreamDecodeAhead() {
+	singleton = this;
+
+	buffer_length = float(GLOBAL_DEF_RST("audio/decode_ahead/buffer_length_ms", 0)) / 1000.0;
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/decode_ahead/buffer_length_ms", PropertyInfo(Variant::INT, "audio/decode_ahead/buffer_length_ms", PROPERTY_HINT_RANGE, "0,2000,1,or_greater"));
+	memory_budget = int64_t(GLOBAL_DEF_RST("audio/decode_ahead/memory_budget_kb", 8192)) * 1024;
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/decode_ahead/memory_budget_kb", PropertyInfo(Variant::INT, "audio/decode_ahead/memory_budget_kb", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"));
+
+	if (buffer_length > 0.0) {
+		thread.start(_thread_func, this);
+		if (!thread.is_started()) {
+			// Threads are not supported, keep decoding on the audio thread.
+			buffer_length = 0.0;
+		}
+	}
+}
+
+AudioStreamDecodeAhead::~AudioStreamDecodeAhead() {
+	if (thread.is_started()) {
+		exit_thread.set();
+		semaphore.post();
+		thread.wait_to_finish();
+	}
+	// Playbacks outliving the server release their own reference.
+	for (uint32_t i = 0; i < streams.size(); i++) {
+		_unref_stream(streams[i]);
+	}
+	singleton = nullptr;
+}
+
 ////////////////////////////////
 
 Ref<AudioStreamPlayback> AudioStream::instance_playback() {
@@ -768,6 +1101,17 @@ void AudioStreamPlaybackRandomizer::seek(float p_time) {
 	}
 }
 
+int AudioStreamPlaybackRandomizer::skip(float p_rate_scale, int p_frames) {
+	if (playing.is_valid()) {
+		return playing->skip(p_rate_scale * pitch_scale, p_frames);
+	}
+	return -1;
+}
+
+bool AudioStreamPlaybackRandomizer::can_skip() const {
+	return playing.is_valid() && playing->can_skip();
+}
+
 int AudioStreamPlaybackRandomizer::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
 	if (playing.is_valid()) {
 		return playing->mix(p_buffer, p_rate_scale * pitch_scale, p_frames);
@@ -33,6 +33,11 @@
 
 #include "core/io/image.h"
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/audio/audio_filter_sw.h"
 #include "servers/audio_server.h"
 
@@ -63,6 +68,62 @@ public:
 	virtual void seek(float p_time);
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames);
+	// Advances the playback as if p_frames were mixed, without producing audio. Used by AudioServer for virtual voices.
+	// Returns the amount of frames skipped (less than p_frames if the stream ended), or -1 if skipping isn't supported.
+	virtual int skip(float p_rate_scale, int p_frames);
+	// Whether skip() is currently supported. Voices that can't skip are always mixed.
+	virtual bool can_skip() const;
+};
+
+class AudioStreamPlaybackResampled;
+
+// Decodes streams ahead of time on a separate thread, so the audio thread doesn't stall on decoding.
+class AudioStreamDecodeAhead {
+public:
+	// Links a playback to the decode-ahead thread. The thread holds a reference while it decodes, so the
+	// registry isn't locked during decoding, and a playback only waits for its own chunk to detach.
+	struct Stream {
+		SafeRefCount refcount;
+		Mutex mutex; // Held while decoding a chunk, and while detaching the playback.
+		AudioStreamPlaybackResampled *playback = nullptr;
+	};
+
+private:
+	static AudioStreamDecodeAhead *singleton;
+
+	Thread thread;
+	Semaphore semaphore;
+	SafeFlag exit_thread;
+
+	Mutex mutex;
+	LocalVector<Stream *> streams;
+
+	float buffer_length = 0.0;
+	int64_t memory_budget = 0;
+	int64_t memory_used = 0;
+
+	static void _thread_func(void *p_userdata);
+	static void _unref_stream(Stream *p_stream);
+
+public:
+	static AudioStreamDecodeAhead *get_singleton() { return singleton; }
+
+	bool is_enabled() const { return buffer_length > 0.0; }
+	int get_buffer_frames(float p_sampling_rate) const;
+
+	// Reserves buffer memory from the shared budget. Returns false if it would exceed it.
+	bool reserve(int64_t p_bytes);
+	void release(int64_t p_bytes);
+	int64_t get_memory_used() const;
+
+	// Returns a stream referenced once for the playback, which must pass it to remove_playback().
+	Stream *add_playback(AudioStreamPlaybackResampled *p_playback);
+	// Waits until the chunk being decoded for this playback, if any, is done. Never call it from the audio thread.
+	void remove_playback(Stream *p_stream);
+	void request_decode() { semaphore.post(); }
+
+	AudioStreamDecodeAhead();
+	~AudioStreamDecodeAhead();
 };
 
 class AudioStreamPlaybackResampled : public AudioStreamPlayback {
@@ -79,11 +140,55 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
+	bool resample_pending = false;
+
+	friend class AudioStreamDecodeAhead;
+
+	// While decode-ahead is active, _mix_internal() only runs on the decode-ahead thread, which is the single
+	// producer of this ring buffer. The audio thread is its single consumer. The positions are free-running.
+	LocalVector<AudioFrame> decode_ahead_buffer;
+	uint32_t decode_ahead_mask = 0;
+	SafeNumeric<uint32_t> decode_ahead_write_pos; // Only advanced by the decode-ahead thread.
+	SafeNumeric<uint32_t> decode_ahead_read_pos; // Only advanced by the audio thread.
+	SafeFlag decode_ahead_active;
+	SafeFlag decode_ahead_ended;
+	// Seeks requested by the audio thread are done by the decode-ahead thread before its next chunk. The audio
+	// thread outputs silence until then, and resumes from the first frame decoded at the new position.
+	SafeNumeric<float> decode_ahead_seek_time;
+	SafeNumeric<uint32_t> decode_ahead_seek_requested;
+	SafeNumeric<uint32_t> decode_ahead_seek_done;
+	SafeNumeric<uint32_t> decode_ahead_seek_start; // Write position of the first frame after the last seek.
+	uint32_t decode_ahead_seek_applied = 0; // Only used by the audio thread.
+	AudioStreamDecodeAhead::Stream *decode_ahead_stream = nullptr;
+	int64_t decode_ahead_bytes = 0;
+
+	// Decodes one chunk into the ring buffer. Returns false once it's full or the stream ended.
+	bool _decode_ahead_chunk();
+	int _read_internal(AudioFrame *p_buffer, int p_frames);
 
 protected:
 	void begin_resample();
+	// Moves decoding to the decode-ahead thread, if enabled in the project settings and within the memory budget.
+	// Call it once the playback is started. Subclasses using it must call end_decode_ahead() before stopping
+	// or freeing their decoder state, including in their destructor.
+	void begin_decode_ahead();
+	void end_decode_ahead();
+	bool is_decode_ahead_active() const { return decode_ahead_active.is_set(); }
+	// Call it from the audio thread instead of seeking the decoder while decode-ahead is active.
+	void request_decode_ahead_seek(float p_time);
+	// While decode-ahead is active, the decoder may have reached the end while its last frames are still
+	// buffered. Subclasses report is_playing() from this instead of their decoder state.
+	bool is_decode_ahead_drained() const;
+	// Frames decoded ahead but not mixed yet, to be subtracted from the decoder position.
+	int get_decode_ahead_frames() const;
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
+	// Advances the stream by p_frames at its own sampling rate. Returns the number of frames skipped, or -1 if unsupported.
+	virtual int _skip_internal(int p_frames);
+	virtual bool _can_skip_internal() const;
+	// Moves the decoder to p_time, restarting it if it reached the end. Called on the decode-ahead thread
+	// for seeks requested with request_decode_ahead_seek().
+	virtual void _seek_internal(float p_time);
 	virtual float get_stream_sampling_rate();
 
 	GDVIRTUAL2R(int, _mix_resampled, GDNativePtr<AudioFrame>, int)
@@ -93,8 +198,11 @@ protected:
 
 public:
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+	virtual int skip(float p_rate_scale, int p_frames) override;
+	virtual bool can_skip() const override;
 
 	AudioStreamPlaybackResampled() { mix_offset = 0; }
+	~AudioStreamPlaybackResampled();
 };
 
 class AudioStream : public Resource {
@@ -264,6 +372,8 @@ public:
 	virtual void seek(float p_time) override;
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+	virtual int skip(float p_rate_scale, int p_frames) override;
+	virtual bool can_skip() const override;
 
 	~AudioStreamPlaybackRandomizer();
 };
@@ -0,0 +1,209 @@
+/*************************************************************************/
+/*  audio_effect_convolution_reverb.cpp                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "audio_effect_convolution_reverb.h"
+
+#include "servers/audio_server.h"
+
+void AudioEffectConvolutionReverbInstance::process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
+	if ((int)wet_buffer.size() < p_frame_count) {
+		wet_buffer.resize(p_frame_count);
+	}
+	convolver.process(p_src_frames, wet_buffer.ptr(), p_frame_count);
+
+	const float dry = base->dry;
+	const float wet = base->wet;
+	for (int i = 0; i < p_frame_count; i++) {
+		p_dst_frames[i] = p_src_frames[i] * dry + wet_buffer[i] * wet;
+	}
+}
+
+AudioEffectConvolutionReverbInstance::~AudioEffectConvolutionReverbInstance() {
+	if (base.is_valid()) {
+		AudioServer::get_singleton()->lock();
+		base->instances.erase(this);
+		AudioServer::get_singleton()->unlock();
+	}
+}
+
+Ref<AudioEffectInstance> AudioEffectConvolutionReverb::instantiate() {
+	Ref<AudioEffectConvolutionReverbInstance> ins;
+	ins.instantiate();
+	ins->base = Ref<AudioEffectConvolutionReverb>(this);
+	if (!kernel) {
+		_update_kernel();
+	}
+
+	AudioServer::get_singleton()->lock();
+	ins->convolver.set_kernel(kernel);
+	instances.push_back(ins.ptr());
+	AudioServer::get_singleton()->unlock();
+	return ins;
+}
+
+Vector<AudioFrame> AudioEffectConvolutionReverb::_get_impulse_frames() const {
+	Vector<AudioFrame> frames;
+
+	if (impulse_response.is_valid()) {
+		ERR_FAIL_COND_V_MSG(impulse_response->get_format() == AudioStreamSample::FORMAT_IMA_ADPCM, frames, "IMA ADPCM impulse responses are not supported, import the impulse response uncompressed.");
+
+		const Vector<uint8_t> data = impulse_response->get_data();
+		const bool stereo = impulse_response->is_stereo();
+		const bool is_16_bits = impulse_response->get_format() == AudioStreamSample::FORMAT_16_BITS;
+		const int channels = stereo ? 2 : 1;
+		const int frame_count = data.size() / (channels * (is_16_bits ? 2 : 1));
+
+		Vector<AudioFrame> source;
+		source.resize(frame_count);
+		AudioFrame *w = source.ptrw();
+		if (is_16_bits) {
+			const int16_t *samples = (const int16_t *)data.ptr();
+			for (int i = 0; i < frame_count; i++) {
+				float l = samples[i * channels] / 32768.0;
+				w[i] = AudioFrame(l, stereo ? samples[i * channels + 1] / 32768.0 : l);
+			}
+		} else {
+			const int8_t *samples = (const int8_t *)data.ptr();
+			for (int i = 0; i < frame_count; i++) {
+				float l = samples[i * channels] / 128.0;
+				w[i] = AudioFrame(l, stereo ? samples[i * channels + 1] / 128.0 : l);
+			}
+		}
+
+		// Resample linearly to the mix rate, the convolution runs on mixed frames.
+		const double ratio = double(impulse_response->get_mix_rate()) / AudioServer::get_singleton()->get_mix_rate();
+		if (frame_count > 0 && ratio > 0 && ratio != 1.0) {
+			const int resampled_count = MAX(1, int(frame_count / ratio));
+			frames.resize(resampled_count);
+			AudioFrame *r = frames.ptrw();
+			for (int i = 0; i < resampled_count; i++) {
+				double pos = i * ratio;
+				int idx = int(pos);
+				float frac = pos - idx;
+				AudioFrame a = source[MIN(idx, frame_count - 1)];
+				AudioFrame b = source[MIN(idx + 1, frame_count - 1)];
+				r[i] = a + (b - a) * frac;
+			}
+		} else {
+			frames = source;
+		}
+	}
+
+	return frames;
+}
+
+void AudioEffectConvolutionReverb::_update_kernel() {
+	Convolver::Kernel *new_kernel = memnew(Convolver::Kernel);
+	new_kernel->build(_get_impulse_frames(), get_partition_frames());
+
+	AudioServer::get_singleton()->lock();
+	Convolver::Kernel *old_kernel = kernel;
+	kernel = new_kernel;
+	for (uint32_t i = 0; i < instances.size(); i++) {
+		instances[i]->convolver.set_kernel(kernel);
+	}
+	AudioServer::get_singleton()->unlock();
+
+	if (old_kernel) {
+		memdelete(old_kernel);
+	}
+}
+
+void AudioEffectConvolutionReverb::set_impulse_response(const Ref<AudioStreamSample> &p_impulse_response) {
+	impulse_response = p_impulse_response;
+	_update_kernel();
+}
+
+Ref<AudioStreamSample> AudioEffectConvolutionReverb::get_impulse_response() const {
+	return impulse_response;
+}
+
+void AudioEffectConvolutionReverb::set_partition_size(PartitionSize p_size) {
+	ERR_FAIL_INDEX(p_size, PARTITION_SIZE_MAX);
+	partition_size = p_size;
+	_update_kernel();
+}
+
+AudioEffectConvolutionReverb::PartitionSize AudioEffectConvolutionReverb::get_partition_size() const {
+	return partition_size;
+}
+
+int AudioEffectConvolutionReverb::get_partition_frames() const {
+	static const int partition_frames[PARTITION_SIZE_MAX] = { 128, 256, 512, 1024, 2048 };
+	return partition_frames[partition_size];
+}
+
+void AudioEffectConvolutionReverb::set_dry(float p_dry) {
+	dry = p_dry;
+}
+
+float AudioEffectConvolutionReverb::get_dry() const {
+	return dry;
+}
+
+void AudioEffectConvolutionReverb::set_wet(float p_wet) {
+	wet = p_wet;
+}
+
+float AudioEffectConvolutionReverb::get_wet() const {
+	return wet;
+}
+
+void AudioEffectConvolutionReverb::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_impulse_response", "impulse_response"), &AudioEffectConvolutionReverb::set_impulse_response);
+	ClassDB::bind_method(D_METHOD("get_impulse_response"), &AudioEffectConvolutionReverb::get_impulse_response);
+
+	ClassDB::bind_method(D_METHOD("set_partition_size", "size"), &AudioEffectConvolutionReverb::set_partition_size);
+	ClassDB::bind_method(D_METHOD("get_partition_size"), &AudioEffectConvolutionReverb::get_partition_size);
+
+	ClassDB::bind_method(D_METHOD("set_dry", "amount"), &AudioEffectConvolutionReverb::set_dry);
+	ClassDB::bind_method(D_METHOD("get_dry"), &AudioEffectConvolutionReverb::get_dry);
+
+	ClassDB::bind_method(D_METHOD("set_wet", "amount"), &AudioEffectConvolutionReverb::set_wet);
+	ClassDB::bind_method(D_METHOD("get_wet"), &AudioEffectConvolutionReverb::get_wet);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "impulse_response", PROPERTY_HINT_RESOURCE_TYPE, "AudioStreamSample"), "set_impulse_response", "get_impulse_response");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "partition_size", PROPERTY_HINT_ENUM, "128,256,512,1024,2048"), "set_partition_size", "get_partition_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "dry", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_dry", "get_dry");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "wet", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_wet", "get_wet");
+
+	BIND_ENUM_CONSTANT(PARTITION_SIZE_128);
+	BIND_ENUM_CONSTANT(PARTITION_SIZE_256);
+	BIND_ENUM_CONSTANT(PARTITION_SIZE_512);
+	BIND_ENUM_CONSTANT(PARTITION_SIZE_1024);
+	BIND_ENUM_CONSTANT(PARTITION_SIZE_2048);
+	BIND_ENUM_CONSTANT(PARTITION_SIZE_MAX);
+}
+
+AudioEffectConvolutionReverb::~AudioEffectConvolutionReverb() {
+	if (kernel) {
+		memdelete(kernel);
+	}
+}
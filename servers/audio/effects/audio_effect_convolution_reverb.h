@@ -0,0 +1,108 @@
+/*************************************************************************/
+/*  audio_effect_convolution_reverb.h                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef AUDIO_EFFECT_CONVOLUTION_REVERB_H
+#define AUDIO_EFFECT_CONVOLUTION_REVERB_H
+
+#include "scene/resources/audio_stream_sample.h"
+#include "servers/audio/audio_effect.h"
+#include "servers/audio/effects/convolver.h"
+
+class AudioEffectConvolutionReverb;
+
+class AudioEffectConvolutionReverbInstance : public AudioEffectInstance {
+	GDCLASS(AudioEffectConvolutionReverbInstance, AudioEffectInstance);
+
+	friend class AudioEffectConvolutionReverb;
+	Ref<AudioEffectConvolutionReverb> base;
+
+	Convolver convolver;
+	LocalVector<AudioFrame> wet_buffer;
+
+public:
+	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override;
+
+	~AudioEffectConvolutionReverbInstance();
+};
+
+class AudioEffectConvolutionReverb : public AudioEffect {
+	GDCLASS(AudioEffectConvolutionReverb, AudioEffect);
+
+public:
+	enum PartitionSize {
+		PARTITION_SIZE_128,
+		PARTITION_SIZE_256,
+		PARTITION_SIZE_512,
+		PARTITION_SIZE_1024,
+		PARTITION_SIZE_2048,
+		PARTITION_SIZE_MAX
+	};
+
+private:
+	friend class AudioEffectConvolutionReverbInstance;
+
+	Ref<AudioStreamSample> impulse_response;
+	PartitionSize partition_size = PARTITION_SIZE_512;
+	float dry = 1.0;
+	float wet = 0.5;
+
+	// Shared by all instances. It is rebuilt on the calling thread, then swapped into the instances with the
+	// audio server locked, so the audio thread never transforms the impulse response or allocates.
+	Convolver::Kernel *kernel = nullptr;
+	LocalVector<AudioEffectConvolutionReverbInstance *> instances;
+
+	Vector<AudioFrame> _get_impulse_frames() const;
+	void _update_kernel();
+
+protected:
+	static void _bind_methods();
+
+public:
+	Ref<AudioEffectInstance> instantiate() override;
+
+	void set_impulse_response(const Ref<AudioStreamSample> &p_impulse_response);
+	Ref<AudioStreamSample> get_impulse_response() const;
+
+	void set_partition_size(PartitionSize p_size);
+	PartitionSize get_partition_size() const;
+	int get_partition_frames() const;
+
+	void set_dry(float p_dry);
+	float get_dry() const;
+
+	void set_wet(float p_wet);
+	float get_wet() const;
+
+	~AudioEffectConvolutionReverb();
+};
+
+VARIANT_ENUM_CAST(AudioEffectConvolutionReverb::PartitionSize);
+
+#endif // AUDIO_EFFECT_CONVOLUTION_REVERB_H
@@ -0,0 +1,286 @@
+/*************************************************************************/
+/*  convolver.cpp                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "convolver.h"
+
+#include "core/math/math_funcs.h"
+
+// Split real and imaginary arrays keep this loop free of shuffles, so it vectorizes well.
+static void _complex_multiply_add(float *r_re, float *r_im, const float *p_a_re, const float *p_a_im, const float *p_b_re, const float *p_b_im, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		r_re[i] += p_a_re[i] * p_b_re[i] - p_a_im[i] * p_b_im[i];
+		r_im[i] += p_a_re[i] * p_b_im[i] + p_a_im[i] * p_b_re[i];
+	}
+}
+
+void Convolver::Kernel::fft(float *p_re, float *p_im) const {
+	for (int i = 0; i < fft_size; i++) {
+		int j = bit_reverse[i];
+		if (i < j) {
+			SWAP(p_re[i], p_re[j]);
+			SWAP(p_im[i], p_im[j]);
+		}
+	}
+
+	for (int size = 2; size <= fft_size; size <<= 1) {
+		int half = size >> 1;
+		int step = fft_size / size;
+		for (int start = 0; start < fft_size; start += size) {
+			for (int k = 0; k < half; k++) {
+				float wr = twiddle_re[k * step];
+				float wi = twiddle_im[k * step];
+				int a = start + k;
+				int b = a + half;
+				float tr = p_re[b] * wr - p_im[b] * wi;
+				float ti = p_re[b] * wi + p_im[b] * wr;
+				p_re[b] = p_re[a] - tr;
+				p_im[b] = p_im[a] - ti;
+				p_re[a] += tr;
+				p_im[a] += ti;
+			}
+		}
+	}
+}
+
+void Convolver::Kernel::split_spectrum(const float *p_re, const float *p_im, float *r_left_re, float *r_left_im, float *r_right_re, float *r_right_im) const {
+	// p_re and p_im hold the transform of left + i * right. As both channels are real, their spectra
+	// can be recovered from the conjugate symmetry, and only the first half of the bins is kept.
+	for (int k = 0; k < bin_count; k++) {
+		int nk = (fft_size - k) & (fft_size - 1);
+		float a = p_re[k];
+		float b = p_im[k];
+		float c = p_re[nk];
+		float d = p_im[nk];
+		r_left_re[k] = (a + c) * 0.5;
+		r_left_im[k] = (b - d) * 0.5;
+		r_right_re[k] = (b + d) * 0.5;
+		r_right_im[k] = (c - a) * 0.5;
+	}
+}
+
+void Convolver::Kernel::build(const Vector<AudioFrame> &p_impulse, int p_block_size) {
+	ERR_FAIL_COND_MSG(p_block_size < 2 || (p_block_size & (p_block_size - 1)), "Convolution block size must be a power of 2.");
+
+	block_size = p_block_size;
+	fft_size = block_size * 2;
+	bin_count = block_size + 1;
+	partition_count = MAX(1, (p_impulse.size() + block_size - 1) / block_size);
+
+	int bits = 0;
+	while ((1 << bits) < fft_size) {
+		bits++;
+	}
+	bit_reverse.resize(fft_size);
+	for (int i = 0; i < fft_size; i++) {
+		int reversed = 0;
+		for (int b = 0; b < bits; b++) {
+			if (i & (1 << b)) {
+				reversed |= 1 << (bits - 1 - b);
+			}
+		}
+		bit_reverse[i] = reversed;
+	}
+
+	twiddle_re.resize(fft_size / 2);
+	twiddle_im.resize(fft_size / 2);
+	for (int i = 0; i < fft_size / 2; i++) {
+		double angle = Math_TAU * i / fft_size;
+		twiddle_re[i] = Math::cos(angle);
+		twiddle_im[i] = -Math::sin(angle);
+	}
+
+	for (int c = 0; c < 2; c++) {
+		ir_re[c].resize(partition_count * bin_count);
+		ir_im[c].resize(partition_count * bin_count);
+	}
+
+	LocalVector<float> work_re;
+	LocalVector<float> work_im;
+	work_re.resize(fft_size);
+	work_im.resize(fft_size);
+
+	const AudioFrame *impulse = p_impulse.ptr();
+	const float scale = 1.0 / fft_size;
+	for (int p = 0; p < partition_count; p++) {
+		for (int i = 0; i < fft_size; i++) {
+			int idx = p * block_size + i;
+			if (i < block_size && idx < p_impulse.size()) {
+				work_re[i] = impulse[idx].l * scale;
+				work_im[i] = impulse[idx].r * scale;
+			} else {
+				work_re[i] = 0;
+				work_im[i] = 0;
+			}
+		}
+		fft(work_re.ptr(), work_im.ptr());
+		int offset = p * bin_count;
+		split_spectrum(work_re.ptr(), work_im.ptr(), &ir_re[0][offset], &ir_im[0][offset], &ir_re[1][offset], &ir_im[1][offset]);
+	}
+}
+
+void Convolver::_accumulate_tail(int p_end) {
+	const int bin_count = kernel->bin_count;
+	const int partition_count = kernel->partition_count;
+	for (int c = 0; c < 2; c++) {
+		float *t_re = tail_re[c].ptr();
+		float *t_im = tail_im[c].ptr();
+		for (int p = tail_partition; p < p_end; p++) {
+			int slot = (fdl_pos - p + partition_count) % partition_count;
+			_complex_multiply_add(t_re, t_im, &fdl_re[c][slot * bin_count], &fdl_im[c][slot * bin_count], &kernel->ir_re[c][p * bin_count], &kernel->ir_im[c][p * bin_count], bin_count);
+		}
+	}
+	tail_partition = MAX(tail_partition, p_end);
+}
+
+void Convolver::_process_block() {
+	const int block_size = kernel->block_size;
+	const int fft_size = kernel->fft_size;
+	const int bin_count = kernel->bin_count;
+
+	for (int i = 0; i < fft_size; i++) {
+		work_re[i] = input[i].l;
+		work_im[i] = input[i].r;
+	}
+	kernel->fft(work_re.ptr(), work_im.ptr());
+
+	int offset = fdl_pos * bin_count;
+	kernel->split_spectrum(work_re.ptr(), work_im.ptr(), &fdl_re[0][offset], &fdl_im[0][offset], &fdl_re[1][offset], &fdl_im[1][offset]);
+
+	_accumulate_tail(kernel->partition_count);
+	for (int c = 0; c < 2; c++) {
+		_complex_multiply_add(tail_re[c].ptr(), tail_im[c].ptr(), &fdl_re[c][offset], &fdl_im[c][offset], kernel->ir_re[c].ptr(), kernel->ir_im[c].ptr(), bin_count);
+	}
+
+	// Pack both spectra back as left + i * right, so a single inverse transform yields both channels.
+	const float *l_re = tail_re[0].ptr();
+	const float *l_im = tail_im[0].ptr();
+	const float *r_re = tail_re[1].ptr();
+	const float *r_im = tail_im[1].ptr();
+	for (int k = 0; k < bin_count; k++) {
+		work_re[k] = l_re[k] - r_im[k];
+		work_im[k] = l_im[k] + r_re[k];
+	}
+	for (int k = 1; k < block_size; k++) {
+		work_re[fft_size - k] = l_re[k] + r_im[k];
+		work_im[fft_size - k] = r_re[k] - l_im[k];
+	}
+
+	// Inverse transform as conj(fft(conj(x))), the 1 / fft_size scale is already applied to the impulse response.
+	for (int i = 0; i < fft_size; i++) {
+		work_im[i] = -work_im[i];
+	}
+	kernel->fft(work_re.ptr(), work_im.ptr());
+
+	// Overlap-save: only the second half of the block is free of circular aliasing.
+	for (int i = 0; i < block_size; i++) {
+		output[i] = AudioFrame(work_re[block_size + i], -work_im[block_size + i]);
+		input[i] = input[block_size + i];
+	}
+
+	fdl_pos = (fdl_pos + 1) % kernel->partition_count;
+
+	for (int c = 0; c < 2; c++) {
+		for (int k = 0; k < bin_count; k++) {
+			tail_re[c][k] = 0;
+			tail_im[c][k] = 0;
+		}
+	}
+	tail_partition = 1;
+}
+
+void Convolver::set_impulse_response(const Vector<AudioFrame> &p_impulse, int p_block_size) {
+	own_kernel.build(p_impulse, p_block_size);
+	set_kernel(&own_kernel);
+}
+
+void Convolver::set_kernel(const Kernel *p_kernel) {
+	// A kernel that failed to build has no partitions, treat it as no kernel at all.
+	kernel = (p_kernel && p_kernel->block_size > 0) ? p_kernel : nullptr;
+
+	if (kernel) {
+		work_re.resize(kernel->fft_size);
+		work_im.resize(kernel->fft_size);
+		input.resize(kernel->fft_size);
+		output.resize(kernel->block_size);
+		for (int c = 0; c < 2; c++) {
+			fdl_re[c].resize(kernel->partition_count * kernel->bin_count);
+			fdl_im[c].resize(kernel->partition_count * kernel->bin_count);
+			tail_re[c].resize(kernel->bin_count);
+			tail_im[c].resize(kernel->bin_count);
+		}
+	}
+
+	clear();
+}
+
+void Convolver::process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
+	if (!kernel) {
+		for (int i = 0; i < p_frame_count; i++) {
+			p_dst_frames[i] = AudioFrame(0, 0);
+		}
+		return;
+	}
+
+	const int block_size = kernel->block_size;
+	for (int i = 0; i < p_frame_count; i++) {
+		input[block_size + input_pos] = p_src_frames[i];
+		p_dst_frames[i] = output[input_pos];
+		input_pos++;
+		if (input_pos == block_size) {
+			_process_block();
+			input_pos = 0;
+		}
+	}
+
+	// Keep the accumulated tail proportional to the part of the block gathered so far.
+	_accumulate_tail(1 + (kernel->partition_count - 1) * input_pos / block_size);
+}
+
+void Convolver::clear() {
+	for (int c = 0; c < 2; c++) {
+		for (uint32_t i = 0; i < fdl_re[c].size(); i++) {
+			fdl_re[c][i] = 0;
+			fdl_im[c][i] = 0;
+		}
+		for (uint32_t i = 0; i < tail_re[c].size(); i++) {
+			tail_re[c][i] = 0;
+			tail_im[c][i] = 0;
+		}
+	}
+	for (uint32_t i = 0; i < input.size(); i++) {
+		input[i] = AudioFrame(0, 0);
+	}
+	for (uint32_t i = 0; i < output.size(); i++) {
+		output[i] = AudioFrame(0, 0);
+	}
+	fdl_pos = 0;
+	tail_partition = 1;
+	input_pos = 0;
+}
@@ -0,0 +1,108 @@
+/*************************************************************************/
+/*  convolver.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef CONVOLVER_H
+#define CONVOLVER_H
+
+#include "core/math/audio_frame.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+
+// Stereo convolution with a long impulse response, using uniformly partitioned overlap-save FFT convolution.
+// The impulse response is split in partitions of block_size frames, so the output is delayed by block_size frames
+// regardless of the impulse length. Every partition but the first only depends on past input blocks, so that
+// "tail" is accumulated a few partitions at a time while the next block is being gathered, spreading its cost
+// over the process calls instead of paying it all when the block completes.
+class Convolver {
+public:
+	// The partitioned spectra of an impulse response. Building it transforms every partition, so it is meant to
+	// be built away from the audio thread, and it can be shared by any number of convolvers.
+	struct Kernel {
+		int block_size = 0;
+		int fft_size = 0;
+		int bin_count = 0;
+		int partition_count = 0;
+
+		LocalVector<int> bit_reverse;
+		LocalVector<float> twiddle_re;
+		LocalVector<float> twiddle_im;
+
+		// Spectra are stored split into real and imaginary arrays so the complex multiply-accumulate vectorizes.
+		// Partition p of a channel lives at [p * bin_count, (p + 1) * bin_count).
+		LocalVector<float> ir_re[2];
+		LocalVector<float> ir_im[2];
+
+		void fft(float *p_re, float *p_im) const;
+		void split_spectrum(const float *p_re, const float *p_im, float *r_left_re, float *r_left_im, float *r_right_re, float *r_right_im) const;
+
+		// Convolves the left input with the left channel and the right input with the right channel.
+		// p_block_size must be a power of 2.
+		void build(const Vector<AudioFrame> &p_impulse, int p_block_size);
+	};
+
+private:
+	const Kernel *kernel = nullptr;
+	Kernel own_kernel;
+
+	// Frequency domain delay line, holding the spectra of the last partition_count input blocks.
+	LocalVector<float> fdl_re[2];
+	LocalVector<float> fdl_im[2];
+	int fdl_pos = 0;
+
+	// Partitions [1, tail_partition) of the next block are already accumulated.
+	LocalVector<float> tail_re[2];
+	LocalVector<float> tail_im[2];
+	int tail_partition = 1;
+
+	LocalVector<float> work_re;
+	LocalVector<float> work_im;
+
+	LocalVector<AudioFrame> input; // Previous and current input block.
+	LocalVector<AudioFrame> output;
+	int input_pos = 0;
+
+	void _accumulate_tail(int p_end);
+	void _process_block();
+
+public:
+	// Builds and uses a kernel owned by this convolver. This allocates and transforms the whole impulse response.
+	void set_impulse_response(const Vector<AudioFrame> &p_impulse, int p_block_size);
+	// Uses a kernel built elsewhere, which must outlive this convolver or be replaced before being freed.
+	// Only the delay line is reallocated, and it is cleared.
+	void set_kernel(const Kernel *p_kernel);
+	int get_block_size() const { return kernel ? kernel->block_size : 0; }
+	int get_partition_count() const { return kernel ? kernel->partition_count : 0; }
+
+	// Writes the convolved (wet) signal, delayed by get_block_size() frames.
+	void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count);
+	void clear();
+};
+
+#endif // CONVOLVER_H
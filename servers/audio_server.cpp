@@ -39,8 +39,10 @@
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
 #include "scene/resources/audio_stream_sample.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
@@ -332,6 +334,35 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	// When the real voice count is limited, only the loudest playing voices are mixed and the rest are virtualized.
+	// Voices that can't skip are always mixed, so they don't count towards the limit.
+	float audibility_threshold = -1.0f;
+	int threshold_voices_left = 0;
+	if (max_real_voices > 0) {
+		voice_audibility.clear();
+		for (AudioStreamPlaybackListNode *playback : playback_list) {
+			if (playback->state.load() == AudioStreamPlaybackListNode::PLAYING && playback->stream_playback->can_skip()) {
+				voice_audibility.push_back(_get_playback_audibility(playback->bus_details.load()));
+			}
+		}
+		int voice_count = voice_audibility.size();
+		if (voice_count > max_real_voices) {
+			int nth = voice_count - max_real_voices;
+			SortArray<float> sorter;
+			sorter.nth_element(0, voice_count, nth, voice_audibility.ptr());
+			audibility_threshold = voice_audibility[nth];
+			// Voices as loud as the threshold are only mixed until the limit is reached.
+			for (int i = nth; i < voice_count; i++) {
+				if (voice_audibility[i] == audibility_threshold) {
+					threshold_voices_left++;
+				}
+			}
+		}
+	}
+
+	uint32_t real_voices = 0;
+	uint32_t virtual_voices = 0;
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
@@ -340,6 +371,40 @@ void AudioServer::_mix_step() {
 
 		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
+		// Only voices that can skip are ramped down to be virtualized, others would be ramped back up on the next mix.
+		if (playback->state.load() == AudioStreamPlaybackListNode::PLAYING && (virtualize_inaudible_voices || max_real_voices > 0) && playback->stream_playback->can_skip()) {
+			float audibility = _get_playback_audibility(playback->bus_details.load());
+			bool make_virtual = virtualize_inaudible_voices && audibility == 0.0f;
+			if (audibility < audibility_threshold || (audibility == audibility_threshold && threshold_voices_left-- <= 0)) {
+				make_virtual = true;
+			}
+
+			if (make_virtual) {
+				if (playback->is_virtual || _get_playback_audibility(playback->prev_bus_details) == 0.0f) {
+					// The voice is silent already, advance it without decoding or mixing.
+					int skipped_frames = playback->stream_playback->skip(playback->pitch_scale.get(), buffer_size);
+					if (skipped_frames >= 0) {
+						if (!playback->is_virtual) {
+							playback->is_virtual = true;
+							for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
+								playback->lookahead[i] = AudioFrame(0, 0);
+							}
+						}
+						virtual_voices++;
+						if (skipped_frames != (int)buffer_size) {
+							playback_list.erase(playback, _free_playback_list_node);
+						}
+						continue;
+					}
+				} else {
+					// Ramp the voice down to silence, it will be virtualized on the next mix.
+					fading_out = true;
+				}
+			}
+			playback->is_virtual = false;
+		}
+		real_voices++;
+
 		AudioFrame *buf = mix_buffer.ptrw();
 
 		// Copy the lookeahead buffer into the mix buffer.
@@ -444,16 +509,7 @@ void AudioServer::_mix_step() {
 		switch (playback->state.load()) {
 			case AudioStreamPlaybackListNode::AWAITING_DELETION:
 			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
-				playback_list.erase(playback, [](AudioStreamPlaybackListNode *p) {
-					if (p->prev_bus_details) {
-						delete p->prev_bus_details;
-					}
-					if (p->bus_details) {
-						delete p->bus_details;
-					}
-					p->stream_playback.unref();
-					delete p;
-				});
+				playback_list.erase(playback, _free_playback_list_node);
 				break;
 			case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
 				// Pause the stream.
@@ -470,6 +526,9 @@ void AudioServer::_mix_step() {
 		}
 	}
 
+	real_voice_count.set(real_voices);
+	virtual_voice_count.set(virtual_voices);
+
 	for (int i = buses.size() - 1; i >= 0; i--) {
 		//go bus by bus
 		Bus *bus = buses[i];
@@ -597,7 +656,45 @@ void AudioServer::_mix_step() {
 	to_mix = buffer_size;
 }
 
+float AudioServer::_get_playback_audibility(const AudioStreamPlaybackBusDetails *p_bus_details) const {
+	if (p_bus_details == nullptr) {
+		return 0.0f;
+	}
+	float audibility = 0.0f;
+	for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		if (!p_bus_details->bus_active[idx]) {
+			continue;
+		}
+		for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+			const AudioFrame &vol = p_bus_details->volume[idx][channel_idx];
+			audibility = MAX(audibility, MAX(vol.l, vol.r));
+		}
+	}
+	return audibility;
+}
+
+// Only called from update() on the main thread, through playback_list.maybe_cleanup(). This can release the
+// last reference to a playback, whose destructor may wait for the decode-ahead thread, so never free it while mixing.
+void AudioServer::_free_playback_list_node(AudioStreamPlaybackListNode *p_playback) {
+	if (p_playback->prev_bus_details) {
+		delete p_playback->prev_bus_details;
+	}
+	if (p_playback->bus_details) {
+		delete p_playback->bus_details;
+	}
+	p_playback->stream_playback.unref();
+	delete p_playback;
+}
+
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	if (p_vol_start.l == 0 && p_vol_start.r == 0 && p_vol_final.l == 0 && p_vol_final.r == 0) {
+		// Silent for the whole step, nothing to add. The filter history is cleared on the next audible step anyway.
+		return;
+	}
+
+	// Make this buffer size invariant if buffer_size ever becomes a project setting.
+	const AudioFrame vol_step = (p_vol_final - p_vol_start) / float(buffer_size);
+
 	if (p_highshelf_gain != 0) {
 		AudioFilterSW filter;
 		filter.set_mode(AudioFilterSW::HIGHSHELF);
@@ -616,21 +713,25 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
+		AudioFrame vol = p_vol_start;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.l);
 			p_processor_r->process_one_interp(mixed.r);
 			p_out_buf[frame_idx] += mixed;
+			vol += vol_step;
 		}
 
+	} else if (p_vol_start.l == p_vol_final.l && p_vol_start.r == p_vol_final.r) {
+		// Constant volume, no ramp needed.
+		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
+			p_out_buf[frame_idx] += p_vol_final * p_source_buf[frame_idx];
+		}
 	} else {
+		AudioFrame vol = p_vol_start;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
+			p_out_buf[frame_idx] += vol * p_source_buf[frame_idx];
+			vol += vol_step;
 		}
 	}
 }
@@ -1312,6 +1413,14 @@ uint64_t AudioServer::get_mix_count() const {
 	return mix_count;
 }
 
+uint32_t AudioServer::get_real_voice_count() const {
+	return real_voice_count.get();
+}
+
+uint32_t AudioServer::get_virtual_voice_count() const {
+	return virtual_voice_count.get();
+}
+
 void AudioServer::notify_listener_changed() {
 	for (CallbackItem *ci : listener_changed_callback_list) {
 		ci->callback(ci->userdata);
@@ -1340,10 +1449,15 @@ void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST("audio/buses/channel_disable_time", 2.0)) * get_mix_rate();
 	ProjectSettings::get_singleton()->set_custom_property_info("audio/buses/channel_disable_time", PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"));
+	virtualize_inaudible_voices = GLOBAL_DEF_RST("audio/voices/virtualize_inaudible_voices", true);
+	max_real_voices = GLOBAL_DEF_RST("audio/voices/max_real_voices", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/voices/max_real_voices", PropertyInfo(Variant::INT, "audio/voices/max_real_voices", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"));
 	buffer_size = 512; //hardcoded for now
 
 	init_channels_and_buffers();
 
+	decode_ahead = memnew(AudioStreamDecodeAhead);
+
 	mix_count = 0;
 	set_bus_count(1);
 	set_bus_name(0, "Master");
@@ -1466,6 +1580,11 @@ void AudioServer::finish() {
 	}
 
 	buses.clear();
+
+	if (decode_ahead) {
+		memdelete(decode_ahead);
+		decode_ahead = nullptr;
+	}
 }
 
 /* MISC config */
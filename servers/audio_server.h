@@ -34,6 +34,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -43,6 +44,7 @@
 
 class AudioDriverDummy;
 class AudioStream;
+class AudioStreamDecodeAhead;
 class AudioStreamSample;
 class AudioStreamPlayback;
 
@@ -182,6 +184,15 @@ private:
 	float channel_disable_threshold_db = 0.0f;
 	uint32_t channel_disable_frames = 0;
 
+	bool virtualize_inaudible_voices = true;
+	int max_real_voices = 0;
+	// Audibility of the playing voices, used to find the loudest ones when the real voice count is limited.
+	LocalVector<float> voice_audibility;
+	SafeNumeric<uint32_t> real_voice_count;
+	SafeNumeric<uint32_t> virtual_voice_count;
+
+	AudioStreamDecodeAhead *decode_ahead = nullptr;
+
 	int channel_count = 0;
 	int to_mix = 0;
 
@@ -252,6 +263,8 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Virtual voices are skipped ahead instead of being mixed. Only accessed on the audio thread.
+		bool is_virtual = false;
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
@@ -274,6 +287,9 @@ private:
 	void _mix_step();
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
+	float _get_playback_audibility(const AudioStreamPlaybackBusDetails *p_bus_details) const;
+	static void _free_playback_list_node(AudioStreamPlaybackListNode *p_playback);
+
 	// Should only be called on the main thread.
 	AudioStreamPlaybackListNode *_find_playback_list_node(Ref<AudioStreamPlayback> p_playback);
 
@@ -381,6 +397,9 @@ public:
 
 	uint64_t get_mix_count() const;
 
+	uint32_t get_real_voice_count() const;
+	uint32_t get_virtual_voice_count() const;
+
 	void notify_listener_changed();
 
 	virtual void init();
@@ -29,6 +29,7 @@
 /*************************************************************************/
 
 #include "mesh_storage.h"
+#include "servers/rendering/renderer_rd/renderer_storage_rd.h"
 
 using namespace RendererRD;
 
@@ -1798,20 +1799,25 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 12;
-
-	dataptr[0] = p_transform.basis.rows[0][0];
-	dataptr[1] = p_transform.basis.rows[0][1];
-	dataptr[2] = p_transform.basis.rows[0][2];
-	dataptr[3] = p_transform.origin.x;
-	dataptr[4] = p_transform.basis.rows[1][0];
-	dataptr[5] = p_transform.basis.rows[1][1];
-	dataptr[6] = p_transform.basis.rows[1][2];
-	dataptr[7] = p_transform.origin.y;
-	dataptr[8] = p_transform.basis.rows[2][0];
-	dataptr[9] = p_transform.basis.rows[2][1];
-	dataptr[10] = p_transform.basis.rows[2][2];
-	dataptr[11] = p_transform.origin.z;
+	RendererStorageRD::store_transform_transposed_3x4(p_transform, skeleton->data.ptrw() + p_bone * 12);
+
+	_skeleton_make_dirty(skeleton);
+}
+
+void MeshStorage::skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform3D> &p_transforms) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_COND(!skeleton);
+	ERR_FAIL_COND(p_transforms.size() > skeleton->size);
+	ERR_FAIL_COND(skeleton->use_2d);
+
+	float *dataptr = skeleton->data.ptrw();
+	const Transform3D *transforms = p_transforms.ptr();
+
+	for (int i = 0; i < p_transforms.size(); i++) {
+		RendererStorageRD::store_transform_transposed_3x4(transforms[i], dataptr);
+		dataptr += 12;
+	}
 
 	_skeleton_make_dirty(skeleton);
 }
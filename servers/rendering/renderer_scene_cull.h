@@ -33,6 +33,7 @@
 
 #include "core/math/dynamic_bvh.h"
 #include "core/templates/bin_sorted_array.h"
+#include "core/templates/frame_arena.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/paged_array.h"
@@ -911,6 +912,8 @@ public:
 	InstanceCullResult scene_cull_result;
 	LocalVector<InstanceCullResult> scene_cull_result_threads;
 
+	FrameArena render_scene_arena; // Scratch memory for a single _render_scene() call.
+
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
@@ -448,6 +448,8 @@ void TextServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("parse_structured_text", "parser_type", "args", "text"), &TextServer::parse_structured_text);
 
+	ADD_SIGNAL(MethodInfo("font_size_cache_evicted", PropertyInfo(Variant::RID, "font_rid")));
+
 	/* Direction */
 	BIND_ENUM_CONSTANT(DIRECTION_AUTO);
 	BIND_ENUM_CONSTANT(DIRECTION_LTR);
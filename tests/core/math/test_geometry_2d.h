@@ -485,6 +485,60 @@ TEST_CASE("[Geometry2D] Merge polygons") {
 	}
 }
 
+TEST_CASE("[Geometry2D] Merge many polygons") {
+	SUBCASE("[Geometry2D] No polygons") {
+		Vector<Vector<Point2>> r = Geometry2D::merge_many_polygons(Vector<Vector<Point2>>());
+		CHECK_MESSAGE(r.is_empty(), "Merging no polygons should result in no polygons.");
+	}
+
+	SUBCASE("[Geometry2D] Row of adjacent squares with mixed windings") {
+		Vector<Vector<Point2>> polygons;
+		for (int i = 0; i < 4; i++) {
+			Vector<Point2> square;
+			square.push_back(Point2(i * 10, 0));
+			square.push_back(Point2(i * 10 + 10, 0));
+			square.push_back(Point2(i * 10 + 10, 10));
+			square.push_back(Point2(i * 10, 10));
+			if (i % 2) {
+				square.reverse();
+			}
+			polygons.push_back(square);
+		}
+
+		Vector<Vector<Point2>> r = Geometry2D::merge_many_polygons(polygons);
+		REQUIRE_MESSAGE(r.size() == 1, "Adjacent squares should merge into 1 polygon.");
+		CHECK_MESSAGE(r[0].size() == 4, "Collinear vertices should be removed from the merged rectangle.");
+		Rect2 bounds(r[0][0], Size2());
+		for (int i = 1; i < r[0].size(); i++) {
+			bounds.expand_to(r[0][i]);
+		}
+		CHECK(bounds.is_equal_approx(Rect2(0, 0, 40, 10)));
+	}
+
+	SUBCASE("[Geometry2D] Ring of squares leaves a hole") {
+		Vector<Vector<Point2>> polygons;
+		for (int y = 0; y < 3; y++) {
+			for (int x = 0; x < 3; x++) {
+				if (x == 1 && y == 1) {
+					continue;
+				}
+				Vector<Point2> square;
+				square.push_back(Point2(x * 10, y * 10));
+				square.push_back(Point2(x * 10 + 10, y * 10));
+				square.push_back(Point2(x * 10 + 10, y * 10 + 10));
+				square.push_back(Point2(x * 10, y * 10 + 10));
+				polygons.push_back(square);
+			}
+		}
+
+		Vector<Vector<Point2>> r = Geometry2D::merge_many_polygons(polygons);
+		REQUIRE_MESSAGE(r.size() == 2, "The ring should result in an outline and a hole.");
+		CHECK(r[0].size() == 4);
+		CHECK(r[1].size() == 4);
+		CHECK_MESSAGE(Geometry2D::is_polygon_clockwise(r[0]) != Geometry2D::is_polygon_clockwise(r[1]), "The outline and the hole should have opposite windings.");
+	}
+}
+
 TEST_CASE("[Geometry2D] Clip polygons") {
 	Vector<Point2> a;
 	Vector<Point2> b;
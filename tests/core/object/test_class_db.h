@@ -33,10 +33,18 @@
 
 #include "core/core_bind.h"
 #include "core/core_constants.h"
+#include "core/io/resource.h"
 #include "core/object/class_db.h"
 
 #include "tests/test_macros.h"
 
+// Declared in global namespace because of GDCLASS macro warning (Windows):
+// "Unqualified friend declaration referring to type outside of the nearest enclosing namespace
+// is a Microsoft extension; add a nested name specifier".
+class _TestLookupObject : public Object {
+	GDCLASS(_TestLookupObject, Object);
+};
+
 namespace TestClassDB {
 
 struct TypeReference {
@@ -852,6 +860,56 @@ TEST_SUITE("[ClassDB]") {
 			}
 		}
 	}
+
+	TEST_CASE("[ClassDB] Inherited member lookup") {
+		MethodBind *method = ClassDB::get_method("Object", "get_instance_id");
+		CHECK(method != nullptr);
+		CHECK(ClassDB::get_method("Resource", "get_instance_id") == method);
+		CHECK(ClassDB::get_method("Resource", "not_a_method") == nullptr);
+		CHECK(ClassDB::has_method("Resource", "get_instance_id"));
+		CHECK_FALSE(ClassDB::has_method("Resource", "get_instance_id", true));
+
+		bool valid = false;
+		CHECK(ClassDB::get_property_type("Resource", "resource_name", &valid) == Variant::STRING);
+		CHECK(valid);
+		ClassDB::get_property_type("Resource", "not_a_property", &valid);
+		CHECK_FALSE(valid);
+
+		Ref<Resource> resource;
+		resource.instantiate();
+		CHECK(ClassDB::set_property(resource.ptr(), "resource_name", "Test", &valid));
+		CHECK(valid);
+		CHECK(resource->get_name() == "Test");
+
+		Variant value;
+		CHECK(ClassDB::get_property(resource.ptr(), "resource_name", value));
+		CHECK(value == Variant("Test"));
+		CHECK(ClassDB::get_property(resource.ptr(), "NOTIFICATION_PREDELETE", value));
+		CHECK(int(value) == Object::NOTIFICATION_PREDELETE);
+		CHECK(ClassDB::get_property(resource.ptr(), "get_instance_id", value));
+		CHECK(value.get_type() == Variant::CALLABLE);
+		CHECK(ClassDB::get_property(resource.ptr(), "changed", value));
+		CHECK(value.get_type() == Variant::SIGNAL);
+		CHECK_FALSE(ClassDB::get_property(resource.ptr(), "not_a_member", value));
+	}
+
+	TEST_CASE("[ClassDB] Binding members updates lookups") {
+		ClassDB::register_class<_TestLookupObject>();
+
+		Object *object = memnew(_TestLookupObject);
+		Variant value;
+		CHECK_FALSE(ClassDB::get_property(object, "resource_name", value));
+		CHECK(ClassDB::get_property(object, "NOTIFICATION_PREDELETE", value));
+		CHECK_FALSE(ClassDB::get_property(object, "TEST_CONSTANT", value));
+
+		ClassDB::bind_integer_constant("_TestLookupObject", StringName(), "TEST_CONSTANT", 42);
+		CHECK(ClassDB::get_property(object, "TEST_CONSTANT", value));
+		CHECK(int(value) == 42);
+		CHECK(ClassDB::get_property(object, "NOTIFICATION_PREDELETE", value));
+		CHECK(int(value) == Object::NOTIFICATION_PREDELETE);
+
+		memdelete(object);
+	}
 }
 } // namespace TestClassDB
 
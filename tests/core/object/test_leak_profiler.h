@@ -0,0 +1,222 @@
+/*************************************************************************/
+/*  test_leak_profiler.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_LEAK_PROFILER_H
+#define TEST_LEAK_PROFILER_H
+
+#include "core/object/leak_profiler.h"
+#include "core/object/ref_counted.h"
+#include "core/object/script_language.h"
+
+#include "tests/test_macros.h"
+
+#ifdef DEBUG_ENABLED
+
+namespace TestLeakProfiler {
+
+static uint32_t get_class_count(const StringName &p_class) {
+	LocalVector<LeakProfiler::ClassStats> stats;
+	LeakProfiler::get_class_stats(stats);
+	for (uint32_t i = 0; i < stats.size(); i++) {
+		if (stats[i].name == p_class) {
+			return stats[i].count;
+		}
+	}
+	return 0;
+}
+
+static bool has_leaked(const ObjectID &p_id) {
+	LocalVector<ObjectID> leaked;
+	LeakProfiler::find_reference_cycles(leaked);
+	for (uint32_t i = 0; i < leaked.size(); i++) {
+		if (leaked[i] == p_id) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Holds a single script member that isn't exported, like a plain `var` in a script.
+class _MockScriptInstance : public ScriptInstance {
+	Variant member;
+
+public:
+	bool set(const StringName &p_name, const Variant &p_value) override {
+		if (p_name == "member") {
+			member = p_value;
+			return true;
+		}
+		return false;
+	}
+	bool get(const StringName &p_name, Variant &r_ret) const override {
+		if (p_name == "member") {
+			r_ret = member;
+			return true;
+		}
+		return false;
+	}
+	void get_property_list(List<PropertyInfo> *p_properties) const override {
+		p_properties->push_back(PropertyInfo(Variant::OBJECT, "member", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_SCRIPT_VARIABLE));
+	}
+	Variant::Type get_property_type(const StringName &p_name, bool *r_is_valid) const override {
+		if (r_is_valid) {
+			*r_is_valid = p_name == "member";
+		}
+		return Variant::OBJECT;
+	}
+	void get_method_list(List<MethodInfo> *p_list) const override {
+	}
+	bool has_method(const StringName &p_method) const override {
+		return false;
+	}
+	Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override {
+		return Variant();
+	}
+	void notification(int p_notification) override {
+	}
+	Ref<Script> get_script() const override {
+		return Ref<Script>();
+	}
+	const Vector<Multiplayer::RPCConfig> get_rpc_methods() const override {
+		return Vector<Multiplayer::RPCConfig>();
+	}
+	ScriptLanguage *get_language() override {
+		return nullptr;
+	}
+};
+
+TEST_CASE("[LeakProfiler] Class and allocation site stats") {
+	uint32_t count = get_class_count("RefCounted");
+
+	Ref<RefCounted> a = memnew(RefCounted);
+	Ref<RefCounted> b = memnew(RefCounted);
+	CHECK_MESSAGE(
+			get_class_count("RefCounted") == count + 2,
+			"New objects should be counted in their class.");
+
+	LocalVector<LeakProfiler::SiteStats> sites;
+	LeakProfiler::get_site_stats(sites);
+	bool found = false;
+	for (uint32_t i = 0; i < sites.size(); i++) {
+		if (sites[i].site.begins_with(__FILE__) && sites[i].class_name == "RefCounted") {
+			found = true;
+			CHECK(sites[i].bytes == sites[i].count * sizeof(RefCounted));
+		}
+	}
+	CHECK_MESSAGE(found, "The allocation site of the new objects should be recorded.");
+
+	a.unref();
+	b.unref();
+	CHECK(get_class_count("RefCounted") == count);
+}
+
+TEST_CASE("[LeakProfiler] Reference cycles") {
+	Ref<RefCounted> a = memnew(RefCounted);
+	Ref<RefCounted> b = memnew(RefCounted);
+	a->set_meta("other", b);
+	b->set_meta("other", a);
+	ObjectID a_id = a->get_instance_id();
+	ObjectID b_id = b->get_instance_id();
+
+	CHECK_MESSAGE(
+			!has_leaked(a_id),
+			"A cycle that is still referenced from outside shouldn't be reported.");
+
+	// Keep both alive through a container that is itself part of the cycle.
+	Array array;
+	array.push_back(b);
+	a->set_meta("array", array);
+	array = Array();
+
+	RefCounted *a_ptr = a.ptr();
+	a.unref();
+	b.unref();
+	CHECK_MESSAGE(
+			has_leaked(a_id),
+			"Objects only referenced by a cycle should be reported.");
+	CHECK_MESSAGE(
+			has_leaked(b_id),
+			"Objects only referenced by a cycle should be reported.");
+
+	// Break the cycle so both objects are freed.
+	Ref<RefCounted> b_ref = Object::cast_to<RefCounted>(ObjectDB::get_instance(b_id));
+	a_ptr->remove_meta("array");
+	b_ref->remove_meta("other");
+	b_ref.unref();
+	CHECK(ObjectDB::get_instance(a_id) == nullptr);
+	CHECK(ObjectDB::get_instance(b_id) == nullptr);
+}
+
+TEST_CASE("[LeakProfiler] Reference cycles through script members") {
+	Ref<RefCounted> a = memnew(RefCounted);
+	Ref<RefCounted> b = memnew(RefCounted);
+	a->set_script_instance(memnew(_MockScriptInstance));
+	b->set_script_instance(memnew(_MockScriptInstance));
+	a->set("member", b);
+	b->set("member", a);
+	ObjectID a_id = a->get_instance_id();
+	ObjectID b_id = b->get_instance_id();
+
+	CHECK_MESSAGE(
+			!has_leaked(a_id),
+			"A cycle that is still referenced from outside shouldn't be reported.");
+
+	RefCounted *a_ptr = a.ptr();
+	a.unref();
+	b.unref();
+	CHECK_MESSAGE(
+			has_leaked(a_id),
+			"Objects only referenced by script members in a cycle should be reported.");
+	CHECK_MESSAGE(
+			has_leaked(b_id),
+			"Objects only referenced by script members in a cycle should be reported.");
+
+	// Break the cycle so both objects are freed.
+	Ref<RefCounted> b_ref = Object::cast_to<RefCounted>(ObjectDB::get_instance(b_id));
+	a_ptr->set("member", Variant());
+	b_ref->set("member", Variant());
+	b_ref.unref();
+	CHECK(ObjectDB::get_instance(a_id) == nullptr);
+	CHECK(ObjectDB::get_instance(b_id) == nullptr);
+}
+
+TEST_CASE("[LeakProfiler] Report") {
+	Dictionary report = LeakProfiler::get_report();
+	CHECK(report.has("classes"));
+	CHECK(report.has("allocation_sites"));
+	CHECK(report.has("reference_cycles"));
+	CHECK(Array(report["classes"]).size() > 0);
+}
+
+} // namespace TestLeakProfiler
+
+#endif // DEBUG_ENABLED
+
+#endif // TEST_LEAK_PROFILER_H
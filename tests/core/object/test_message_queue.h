@@ -0,0 +1,179 @@
+/*************************************************************************/
+/*  test_message_queue.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class MessageQueueTarget : public Object {
+public:
+	LocalVector<int> values;
+	int requeue_count = 0;
+	int requeue_limit = 3;
+
+	void add_value(int p_value) {
+		values.push_back(p_value);
+	}
+
+	void requeue() {
+		values.push_back(requeue_count);
+		if (requeue_count < requeue_limit) {
+			requeue_count++;
+			MessageQueue::get_singleton()->push_callable(callable_mp(this, &MessageQueueTarget::requeue));
+		}
+	}
+};
+
+// Uses the existing queue if there is one, otherwise creates one for the test.
+class MessageQueueScope {
+	MessageQueue *created = nullptr;
+
+public:
+	MessageQueue *queue = nullptr;
+
+	MessageQueueScope() {
+		queue = MessageQueue::get_singleton();
+		if (!queue) {
+			created = memnew(MessageQueue);
+			queue = created;
+		}
+	}
+
+	~MessageQueueScope() {
+		if (created) {
+			memdelete(created);
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Calls are flushed in order and the queue grows as needed") {
+	MessageQueueScope scope;
+	MessageQueueTarget *target = memnew(MessageQueueTarget);
+
+	// Enough messages to span several pages.
+	const int count = 10000;
+	for (int pass = 0; pass < 2; pass++) {
+		target->values.clear();
+		bool all_queued = true;
+		for (int i = 0; i < count; i++) {
+			all_queued = scope.queue->push_callable(callable_mp(target, &MessageQueueTarget::add_value), i) == OK && all_queued;
+		}
+		CHECK(all_queued);
+		scope.queue->flush();
+
+		bool in_order = int(target->values.size()) == count;
+		for (uint32_t i = 0; in_order && i < target->values.size(); i++) {
+			in_order = target->values[i] == int(i);
+		}
+		CHECK_MESSAGE(in_order, "All calls should be made in the order they were queued.");
+	}
+
+	memdelete(target);
+}
+
+TEST_CASE("[MessageQueue] Calls queued while flushing") {
+	MessageQueueScope scope;
+	MessageQueueTarget *target = memnew(MessageQueueTarget);
+
+	scope.queue->push_callable(callable_mp(target, &MessageQueueTarget::requeue));
+	scope.queue->flush();
+
+	CHECK(target->values.size() == 4);
+	CHECK(target->values[3] == 3);
+
+	memdelete(target);
+}
+
+TEST_CASE("[MessageQueue] Calls queuing themselves across several pages") {
+	MessageQueueScope scope;
+	MessageQueueTarget *target = memnew(MessageQueueTarget);
+
+	// Consumed pages are recycled while the chain keeps queuing more calls.
+	target->requeue_limit = 20000;
+	scope.queue->push_callable(callable_mp(target, &MessageQueueTarget::requeue));
+	scope.queue->flush();
+
+	CHECK(int(target->values.size()) == target->requeue_limit + 1);
+	bool in_order = true;
+	for (uint32_t i = 0; i < target->values.size(); i++) {
+		in_order = in_order && target->values[i] == int(i);
+	}
+	CHECK(in_order);
+
+	memdelete(target);
+}
+
+#if !defined(NO_THREADS)
+
+static void _queue_calls(void *p_userdata) {
+	MessageQueueTarget *target = (MessageQueueTarget *)p_userdata;
+	for (int i = 0; i < 1000; i++) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(target, &MessageQueueTarget::add_value), i);
+	}
+}
+
+TEST_CASE("[MessageQueue] Calls queued from other threads") {
+	MessageQueueScope scope;
+	MessageQueueTarget *target = memnew(MessageQueueTarget);
+
+	Thread thread1;
+	Thread thread2;
+	thread1.start(_queue_calls, target);
+	thread2.start(_queue_calls, target);
+	thread1.wait_to_finish();
+	thread2.wait_to_finish();
+
+	scope.queue->flush();
+
+	CHECK(target->values.size() == 2000);
+
+	// Each thread's calls are flushed together, in the order they were queued.
+	bool in_order = true;
+	for (uint32_t i = 0; i < target->values.size(); i++) {
+		in_order = in_order && target->values[i] == int(i % 1000);
+	}
+	CHECK(in_order);
+
+	memdelete(target);
+}
+
+#endif // NO_THREADS
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
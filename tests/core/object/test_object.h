@@ -35,6 +35,8 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 
 #include "tests/test_macros.h"
 
@@ -275,6 +277,176 @@ TEST_CASE("[Object] Absent name getter") {
 			actual_value == Variant(),
 			"The returned value should equal nil variant.");
 }
+class _SignalReceiver : public Object {
+public:
+	Object *emitter = nullptr;
+	int calls = 0;
+	Variant last_arg;
+	Variant last_bind;
+
+	void receive(const Variant &p_arg) {
+		calls++;
+		last_arg = p_arg;
+	}
+
+	void receive_with_bind(const Variant &p_arg, const Variant &p_bind) {
+		calls++;
+		last_arg = p_arg;
+		last_bind = p_bind;
+	}
+
+	void receive_and_disconnect(const Variant &p_arg) {
+		calls++;
+		emitter->disconnect("test_signal", callable_mp(this, &_SignalReceiver::receive_and_disconnect));
+	}
+
+	void receive_int(int p_value) {
+		calls++;
+		last_arg = p_value;
+	}
+};
+
+TEST_CASE("[Object] Signal emission") {
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("test_signal", PropertyInfo(Variant::INT, "value")));
+
+	_SignalReceiver receiver_a;
+	_SignalReceiver receiver_b;
+	receiver_a.emitter = &emitter;
+	receiver_b.emitter = &emitter;
+
+	SUBCASE("Arguments and binds are passed") {
+		emitter.connect("test_signal", callable_mp(&receiver_a, &_SignalReceiver::receive));
+		emitter.connect("test_signal", callable_mp(&receiver_b, &_SignalReceiver::receive_with_bind), varray("bound"));
+
+		CHECK(emitter.emit_signal("test_signal", 42) == OK);
+		CHECK(receiver_a.calls == 1);
+		CHECK(receiver_a.last_arg == Variant(42));
+		CHECK(receiver_b.calls == 1);
+		CHECK(receiver_b.last_arg == Variant(42));
+		CHECK(receiver_b.last_bind == Variant("bound"));
+	}
+
+	SUBCASE("Disconnecting during emission does not skip other connections") {
+		emitter.connect("test_signal", callable_mp(&receiver_a, &_SignalReceiver::receive_and_disconnect));
+		emitter.connect("test_signal", callable_mp(&receiver_b, &_SignalReceiver::receive));
+
+		emitter.emit_signal("test_signal", 1);
+		CHECK(receiver_a.calls == 1);
+		CHECK(receiver_b.calls == 1);
+
+		emitter.emit_signal("test_signal", 2);
+		CHECK_MESSAGE(receiver_a.calls == 1, "The connection should be gone after the first emission.");
+		CHECK(receiver_b.calls == 2);
+	}
+
+	SUBCASE("One-shot connections are removed after emission") {
+		emitter.connect("test_signal", callable_mp(&receiver_a, &_SignalReceiver::receive), Vector<Variant>(), Object::CONNECT_ONESHOT);
+
+		emitter.emit_signal("test_signal", 1);
+		emitter.emit_signal("test_signal", 2);
+		CHECK(receiver_a.calls == 1);
+		CHECK(receiver_a.last_arg == Variant(1));
+	}
+
+	SUBCASE("Typed callables receive C++ arguments") {
+		Callable typed = callable_mp(&receiver_a, &_SignalReceiver::receive_int);
+		CHECK(typed.get_ptrcall_signature() == CallablePtrcallSignature<int>::get());
+		CHECK(typed.get_ptrcall_signature() != CallablePtrcallSignature<float>::get());
+		CHECK(CallablePtrcallSignature<int>::get() != CallablePtrcallSignature<int, int>::get());
+		CHECK(CallablePtrcallSignature<>::get() != CallablePtrcallSignature<int>::get());
+		CHECK(Callable(&receiver_a, "receive_int").get_ptrcall_signature() == nullptr);
+
+		emitter.connect("test_signal", typed);
+		emitter.connect("test_signal", callable_mp(&receiver_b, &_SignalReceiver::receive));
+
+		// Called directly for the typed callable, with a Variant for the other one.
+		emitter.emit_signal("test_signal", 42);
+		CHECK(receiver_a.calls == 1);
+		CHECK(receiver_a.last_arg == Variant(42));
+		CHECK(receiver_b.calls == 1);
+		CHECK(receiver_b.last_arg == Variant(42));
+
+		// Different argument types fall back to Variant conversion.
+		emitter.emit_signal("test_signal", 2.5);
+		CHECK(receiver_a.calls == 2);
+		CHECK(receiver_a.last_arg == Variant(2));
+		CHECK(receiver_b.last_arg == Variant(2.5));
+	}
+
+	SUBCASE("Typed one-shot connections are removed after emission") {
+		emitter.connect("test_signal", callable_mp(&receiver_a, &_SignalReceiver::receive_int), Vector<Variant>(), Object::CONNECT_ONESHOT);
+
+		emitter.emit_signal("test_signal", 1);
+		emitter.emit_signal("test_signal", 2);
+		CHECK(receiver_a.calls == 1);
+		CHECK(receiver_a.last_arg == Variant(1));
+	}
+}
+
+TEST_CASE("[ObjectDB] Instance lookup") {
+	Object *object = memnew(Object);
+	ObjectID id = object->get_instance_id();
+	int object_count = ObjectDB::get_object_count();
+
+	CHECK(ObjectDB::get_instance(id) == object);
+	CHECK(ObjectDB::get_instance(ObjectID()) == nullptr);
+
+	memdelete(object);
+	CHECK_MESSAGE(ObjectDB::get_instance(id) == nullptr, "Freed objects should not be found anymore.");
+	CHECK(ObjectDB::get_object_count() == object_count - 1);
+
+	// The freed slot is likely reused right away, the old ID must still not resolve.
+	Object *other = memnew(Object);
+	CHECK(other->get_instance_id() != id);
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+	CHECK(ObjectDB::get_instance(other->get_instance_id()) == other);
+	memdelete(other);
+}
+
+#if !defined(NO_THREADS)
+
+static void _create_objects(void *p_userdata) {
+	LocalVector<Object *> *objects = (LocalVector<Object *> *)p_userdata;
+	for (uint32_t i = 0; i < objects->size(); i++) {
+		(*objects)[i] = memnew(Object);
+	}
+}
+
+TEST_CASE("[ObjectDB] Objects created and freed on different threads") {
+	int object_count = ObjectDB::get_object_count();
+
+	LocalVector<Object *> objects;
+	objects.resize(1000);
+
+	Thread thread;
+	thread.start(_create_objects, &objects);
+	thread.wait_to_finish();
+
+	CHECK(ObjectDB::get_object_count() == object_count + 1000);
+
+	LocalVector<ObjectID> ids;
+	bool all_found = true;
+	for (uint32_t i = 0; i < objects.size(); i++) {
+		ids.push_back(objects[i]->get_instance_id());
+		all_found = all_found && ObjectDB::get_instance(ids[i]) == objects[i];
+	}
+	CHECK(all_found);
+
+	for (uint32_t i = 0; i < objects.size(); i++) {
+		memdelete(objects[i]);
+	}
+
+	bool none_found = true;
+	for (uint32_t i = 0; i < ids.size(); i++) {
+		none_found = none_found && ObjectDB::get_instance(ids[i]) == nullptr;
+	}
+	CHECK(none_found);
+	CHECK(ObjectDB::get_object_count() == object_count);
+}
+
+#endif // NO_THREADS
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
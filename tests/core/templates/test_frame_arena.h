@@ -0,0 +1,148 @@
+/*************************************************************************/
+/*  test_frame_arena.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/templates/frame_arena.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Allocation and reset") {
+	FrameArena arena(1024);
+
+	uint8_t *a = (uint8_t *)arena.alloc(3);
+	uint8_t *b = (uint8_t *)arena.alloc(20);
+	CHECK_MESSAGE(((uintptr_t)a % 16) == 0, "Allocations should be aligned to 16 bytes.");
+	CHECK_MESSAGE(((uintptr_t)b % 16) == 0, "Allocations should be aligned to 16 bytes.");
+	CHECK(a != b);
+	CHECK(arena.get_allocation_count() == 2);
+
+	arena.reset();
+	CHECK(arena.get_allocation_count() == 0);
+	CHECK(arena.get_used() == 0);
+	CHECK_MESSAGE(arena.alloc(3) == a, "Memory should be handed out again after a reset.");
+}
+
+TEST_CASE("[FrameArena] Reallocation") {
+	FrameArena arena(1024);
+
+	uint8_t *a = (uint8_t *)arena.alloc(16);
+	for (int i = 0; i < 16; i++) {
+		a[i] = i;
+	}
+	CHECK_MESSAGE(arena.realloc(a, 64) == a, "The last allocation should grow in place.");
+
+	arena.alloc(16);
+	uint8_t *moved = (uint8_t *)arena.realloc(a, 128);
+	CHECK(moved != a);
+	bool contents_kept = true;
+	for (int i = 0; i < 16; i++) {
+		contents_kept = contents_kept && moved[i] == i;
+	}
+	CHECK(contents_kept);
+}
+
+TEST_CASE("[FrameArena] Settles on a single chunk") {
+	FrameArena arena(256);
+
+	for (int i = 0; i < 100; i++) {
+		arena.alloc(100);
+	}
+	uint32_t chunk_allocations = arena.get_chunk_allocation_count();
+	CHECK(chunk_allocations > 1);
+
+	arena.reset();
+	chunk_allocations = arena.get_chunk_allocation_count();
+
+	// The same frame again should not need the heap anymore.
+	for (int frame = 0; frame < 3; frame++) {
+		for (int i = 0; i < 100; i++) {
+			arena.alloc(100);
+		}
+		arena.reset();
+	}
+	CHECK(arena.get_chunk_allocation_count() == chunk_allocations);
+}
+
+TEST_CASE("[FrameArena] Containers") {
+	FrameArena arena;
+	FrameArena::Scope scope(&arena);
+	CHECK(FrameArena::get_current() == &arena);
+
+	LocalVector<int, uint32_t, false, FrameArenaAllocator> vector;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 1000);
+	CHECK(vector[999] == 999);
+
+	List<String, FrameArenaAllocator> list;
+	list.push_back("a");
+	list.push_back("b");
+	CHECK(list.size() == 2);
+	CHECK(list.back()->get() == "b");
+
+	HashMap<int, String, HashMapHasherDefault, HashMapComparatorDefault<int>, FrameArenaTypedAllocator<HashMapElement<int, String>>> map;
+	map.insert(1, "one");
+	map.insert(2, "two");
+	CHECK(map[2] == "two");
+
+	uint32_t allocations = arena.get_allocation_count();
+	CHECK(allocations > 0);
+
+	vector.clear();
+	list.clear();
+	map.clear();
+	arena.reset();
+}
+
+TEST_CASE("[FrameArena] Nested scopes") {
+	FrameArena outer;
+	FrameArena inner;
+	{
+		FrameArena::Scope outer_scope(&outer);
+		{
+			FrameArena::Scope inner_scope(&inner);
+			CHECK(FrameArena::get_current() == &inner);
+		}
+		CHECK(FrameArena::get_current() == &outer);
+	}
+	CHECK(FrameArena::get_current() == nullptr);
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
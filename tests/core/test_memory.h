@@ -0,0 +1,191 @@
+/*************************************************************************/
+/*  test_memory.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+#include "core/os/small_object_allocator.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+TEST_CASE("[Memory] Reallocation keeps contents") {
+	uint8_t *mem = (uint8_t *)memalloc(10);
+	for (int i = 0; i < 10; i++) {
+		mem[i] = i;
+	}
+
+	// Small to large, then back into a small size class.
+	mem = (uint8_t *)memrealloc(mem, 5000);
+	for (int i = 10; i < 5000; i++) {
+		mem[i] = i % 256;
+	}
+	mem = (uint8_t *)memrealloc(mem, 700);
+
+	bool contents_kept = true;
+	for (int i = 0; i < 700; i++) {
+		contents_kept = contents_kept && mem[i] == i % 256;
+	}
+	CHECK_MESSAGE(contents_kept, "Contents should survive moving between allocators.");
+
+	memfree(mem);
+}
+
+TEST_CASE("[Memory] Thread allocation counting") {
+	CHECK(!Memory::is_thread_alloc_tracking_enabled());
+
+	uint64_t count = Memory::get_thread_alloc_count();
+	void *untracked = memalloc(32);
+	CHECK_MESSAGE(Memory::get_thread_alloc_count() == count, "Allocations should not be counted unless tracking is enabled.");
+
+	Memory::set_thread_alloc_tracking_enabled(true);
+	void *small = memalloc(32);
+	void *large = memalloc(4096);
+	Memory::set_thread_alloc_tracking_enabled(false);
+
+	CHECK(Memory::get_thread_alloc_count() == count + 2);
+
+	Memory::set_thread_alloc_tracking_enabled(true);
+	void *reallocated = memrealloc(nullptr, 32);
+	CHECK_MESSAGE(Memory::get_thread_alloc_count() == count + 3, "Reallocating null should be counted.");
+	reallocated = memrealloc(reallocated, 8192);
+	CHECK_MESSAGE(Memory::get_thread_alloc_count() == count + 4, "Growing a block should be counted.");
+	Memory::set_thread_alloc_tracking_enabled(false);
+
+	memfree(untracked);
+	memfree(small);
+	memfree(large);
+	memfree(reallocated);
+}
+
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+
+TEST_CASE("[SmallObjectAllocator] Size classes") {
+	void *tiny = SmallObjectAllocator::alloc(1);
+	void *medium = SmallObjectAllocator::alloc(100);
+	void *largest = SmallObjectAllocator::alloc(SmallObjectAllocator::MAX_SIZE);
+
+	CHECK(SmallObjectAllocator::get_block_size(tiny) == 16);
+	CHECK(SmallObjectAllocator::get_block_size(medium) == 112);
+	CHECK(SmallObjectAllocator::get_block_size(largest) == SmallObjectAllocator::MAX_SIZE);
+	CHECK_MESSAGE(((uintptr_t)tiny % 16) == 0, "Blocks should be aligned to 16 bytes.");
+	CHECK_MESSAGE(((uintptr_t)medium % 16) == 0, "Blocks should be aligned to 16 bytes.");
+
+	CHECK_MESSAGE(SmallObjectAllocator::alloc(SmallObjectAllocator::MAX_SIZE + 1) == nullptr, "Large requests should be left to malloc.");
+
+	void *foreign = malloc(16);
+	CHECK_MESSAGE(SmallObjectAllocator::get_block_size(foreign) == 0, "Memory from malloc should not be claimed.");
+	CHECK_MESSAGE(!SmallObjectAllocator::free(foreign), "Memory from malloc should not be claimed.");
+	CHECK_MESSAGE(SmallObjectAllocator::get_block_size(nullptr) == 0, "Null should not be claimed.");
+	CHECK_MESSAGE(!SmallObjectAllocator::free(nullptr), "Null should not be claimed.");
+	free(foreign);
+
+	CHECK(SmallObjectAllocator::free(tiny));
+	CHECK(SmallObjectAllocator::free(medium));
+	CHECK(SmallObjectAllocator::free(largest));
+}
+
+TEST_CASE("[SmallObjectAllocator] Empty spans are reused by other size classes") {
+	const int block_count = 8192;
+	LocalVector<void *> blocks;
+	blocks.resize(block_count);
+
+	for (int i = 0; i < block_count; i++) {
+		blocks[i] = SmallObjectAllocator::alloc(64);
+	}
+	for (int i = 0; i < block_count; i++) {
+		SmallObjectAllocator::free(blocks[i]);
+	}
+
+	uint32_t span_count = SmallObjectAllocator::get_span_count();
+	CHECK_MESSAGE(SmallObjectAllocator::get_free_span_count() > 0, "Spans should go back to the pool once empty.");
+
+	// Same amount of memory, different size class.
+	for (int i = 0; i < block_count / 2; i++) {
+		blocks[i] = SmallObjectAllocator::alloc(128);
+	}
+	CHECK_MESSAGE(SmallObjectAllocator::get_span_count() <= span_count + 16, "Freed spans should be reused instead of allocating new ones.");
+
+	for (int i = 0; i < block_count / 2; i++) {
+		SmallObjectAllocator::free(blocks[i]);
+	}
+}
+
+#if !defined(NO_THREADS)
+
+static void _allocate_blocks(void *p_userdata) {
+	LocalVector<void *> *blocks = (LocalVector<void *> *)p_userdata;
+	for (uint32_t i = 0; i < blocks->size(); i++) {
+		(*blocks)[i] = SmallObjectAllocator::alloc(48);
+		memset((*blocks)[i], 0xAB, 48);
+	}
+}
+
+TEST_CASE("[SmallObjectAllocator] Freeing blocks allocated by another thread") {
+	LocalVector<void *> blocks;
+	blocks.resize(1000);
+
+	Thread thread;
+	thread.start(_allocate_blocks, &blocks);
+	thread.wait_to_finish();
+
+	bool all_owned = true;
+	for (uint32_t i = 0; i < blocks.size(); i++) {
+		all_owned = all_owned && SmallObjectAllocator::get_block_size(blocks[i]) == 48;
+	}
+	CHECK(all_owned);
+
+	bool all_freed = true;
+	for (uint32_t i = 0; i < blocks.size(); i++) {
+		all_freed = SmallObjectAllocator::free(blocks[i]) && all_freed;
+	}
+	CHECK(all_freed);
+
+	// The blocks now sit in the cache of this thread and get handed out again.
+	void *block = SmallObjectAllocator::alloc(48);
+	bool reused = false;
+	for (uint32_t i = 0; i < blocks.size(); i++) {
+		reused = reused || blocks[i] == block;
+	}
+	CHECK(reused);
+	SmallObjectAllocator::free(block);
+}
+
+#endif // NO_THREADS
+
+#endif // SMALL_OBJECT_ALLOCATOR_ENABLED
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
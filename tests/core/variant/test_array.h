@@ -31,6 +31,7 @@
 #ifndef TEST_ARRAY_H
 #define TEST_ARRAY_H
 
+#include "core/object/ref_counted.h"
 #include "core/variant/array.h"
 #include "tests/test_macros.h"
 #include "tests/test_tools.h"
@@ -516,6 +517,72 @@ TEST_CASE("[Array] Recursive self comparison") {
 	a2.clear();
 }
 
+TEST_CASE("[Array] Typed array resize") {
+	Array arr;
+	arr.set_typed(Variant::INT, StringName(), Variant());
+	arr.push_back(5);
+	arr.resize(4);
+
+	// New elements of typed arrays are default values instead of null, on purpose.
+	CHECK(int(arr.size()) == 4);
+	CHECK(int(arr[0]) == 5);
+	for (int i = 1; i < arr.size(); i++) {
+		CHECK(arr[i].get_type() == Variant::INT);
+		CHECK(int(arr[i]) == 0);
+	}
+
+	Array string_arr;
+	string_arr.set_typed(Variant::STRING, StringName(), Variant());
+	string_arr.resize(1);
+	CHECK(string_arr[0].get_type() == Variant::STRING);
+	CHECK(String(string_arr[0]).is_empty());
+
+	Array object_arr;
+	object_arr.set_typed(Variant::OBJECT, "Object", Variant());
+	object_arr.resize(1);
+	CHECK(object_arr[0].get_type() == Variant::NIL);
+
+	Array untyped;
+	untyped.resize(2);
+	CHECK(untyped[0].get_type() == Variant::NIL);
+	CHECK(untyped[1].get_type() == Variant::NIL);
+}
+
+TEST_CASE("[Array] Typed object array") {
+	Array arr;
+	arr.set_typed(Variant::OBJECT, "Object", Variant());
+
+	Ref<RefCounted> ref1;
+	ref1.instantiate();
+	Ref<RefCounted> ref2;
+	ref2.instantiate();
+
+	// Objects of the same derived class are accepted repeatedly.
+	arr.push_back(ref1);
+	arr.push_back(ref2);
+	arr.push_back(ref1);
+	CHECK(int(arr.size()) == 3);
+
+	Array ref_arr;
+	ref_arr.set_typed(Variant::OBJECT, "RefCounted", Variant());
+	Object *obj = memnew(Object);
+
+	ERR_PRINT_OFF;
+	ref_arr.push_back(obj);
+	ERR_PRINT_ON;
+	CHECK(int(ref_arr.size()) == 0);
+
+	ref_arr.push_back(ref1);
+	CHECK(int(ref_arr.size()) == 1);
+
+	ERR_PRINT_OFF;
+	ref_arr.push_back(obj);
+	ERR_PRINT_ON;
+	CHECK(int(ref_arr.size()) == 1);
+
+	memdelete(obj);
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
@@ -500,6 +500,35 @@ TEST_CASE("[Dictionary] Recursive self comparison") {
 	d2.clear();
 }
 
+TEST_CASE("[Dictionary] StringName and String keys are interchangeable") {
+	Dictionary map;
+	map["name"] = 1;
+	map[StringName("other")] = 2;
+	map[StringName(StaticCString::create("static"), true)] = 3;
+	map[""] = 4;
+
+	CHECK(map.size() == 4);
+	CHECK_MESSAGE(map.keys()[1].get_type() == Variant::STRING, "StringName keys should be stored as String.");
+
+	CHECK(int(map[StringName("name")]) == 1);
+	CHECK(int(map["other"]) == 2);
+	CHECK(int(map["static"]) == 3);
+	CHECK(int(map[StringName(StaticCString::create("static"), true)]) == 3);
+	CHECK(int(map[StringName()]) == 4);
+	CHECK(map.size() == 4);
+
+	CHECK(map.has(StringName("name")));
+	CHECK(!map.has(StringName("missing")));
+	const Variant *value = map.getptr(StringName("other"));
+	REQUIRE(value != nullptr);
+	CHECK(int(*value) == 2);
+	CHECK(int(map.get_valid(StringName("other"))) == 2);
+
+	CHECK(map.erase(StringName("name")));
+	CHECK(!map.has("name"));
+	CHECK(map.size() == 3);
+}
+
 } // namespace TestDictionary
 
 #endif // TEST_DICTIONARY_H
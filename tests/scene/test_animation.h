@@ -309,6 +309,28 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Compressed 3D position track interpolation") {
+	Ref<Animation> animation = memnew(Animation);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	animation->set_length(10.0);
+	for (int i = 0; i <= 200; i++) {
+		const double time = i * 0.05;
+		animation->position_track_insert_key(track_index, time, Vector3(time, time * 2.0, -time));
+	}
+
+	// Use a small page size so that the keys are spread over several pages.
+	animation->compress(256);
+	CHECK(animation->track_is_compressed(0));
+
+	Vector3 r_interpolation;
+	for (int i = 0; i <= 100; i++) {
+		const double time = i * 0.0999;
+		CHECK(animation->position_track_interpolate(0, time, &r_interpolation) == OK);
+		CHECK(r_interpolation.distance_to(Vector3(time, time * 2.0, -time)) < 0.05);
+	}
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
@@ -0,0 +1,114 @@
+/*************************************************************************/
+/*  test_animation_player.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_ANIMATION_PLAYER_H
+#define TEST_ANIMATION_PLAYER_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/animation/animation_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/animation_library.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationPlayer {
+
+TEST_CASE("[SceneTree][AnimationPlayer] Process interval") {
+	Node2D *node = memnew(Node2D);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	node->add_child(player);
+
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(10);
+	const int track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track, NodePath(".:position"));
+	animation->track_insert_key(track, 0, Vector2(0, 0));
+	animation->track_insert_key(track, 10, Vector2(10, 0));
+	Ref<AnimationLibrary> library = memnew(AnimationLibrary);
+	library->add_animation("move", animation);
+	player->add_animation_library("", library);
+
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	player->set_process_interval(0.5);
+	player->play("move");
+
+	SceneTree::get_singleton()->process(0.125);
+	CHECK_MESSAGE(
+			node->get_position().is_equal_approx(Vector2(0.125, 0)),
+			"A newly started animation should be posed on the next process frame.");
+
+	// Less than an interval, so at most one update happens wherever its phase is.
+	int updates = 0;
+	Vector2 last_position = node->get_position();
+	for (int i = 0; i < 4; i++) {
+		player->play("move");
+		SceneTree::get_singleton()->process(0.1);
+		if (!node->get_position().is_equal_approx(last_position)) {
+			last_position = node->get_position();
+			updates++;
+		}
+	}
+	CHECK_MESSAGE(
+			updates <= 1,
+			"Playing the current animation again shouldn't disable throttling.");
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK_MESSAGE(
+			node->get_position().is_equal_approx(Vector2(1.025, 0)),
+			"The time skipped should be applied at once when the interval has elapsed.");
+
+	player->set_process_interval(0);
+	SceneTree::get_singleton()->process(0.125);
+	CHECK_MESSAGE(
+			node->get_position().is_equal_approx(Vector2(1.15, 0)),
+			"Without an interval, every process frame should update the animation.");
+
+	memdelete(node);
+}
+
+TEST_CASE("[AnimationPlayer] Process interval phase doesn't use the global random number generator") {
+	Math::seed(1234);
+	const uint32_t expected = Math::rand();
+
+	Math::seed(1234);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->set_process_interval(0.5);
+	AnimationTree *tree = memnew(AnimationTree);
+	tree->set_process_interval(0.5);
+	CHECK(Math::rand() == expected);
+
+	memdelete(tree);
+	memdelete(player);
+}
+
+} // namespace TestAnimationPlayer
+
+#endif // TEST_ANIMATION_PLAYER_H
@@ -0,0 +1,133 @@
+/*************************************************************************/
+/*  test_tile_map.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TILE_MAP_H
+#define TEST_TILE_MAP_H
+
+#include "scene/2d/tile_map.h"
+#include "scene/resources/texture.h"
+#include "scene/resources/tile_set.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTileMap {
+
+TEST_CASE("[SceneTree][TileMap] Baked quadrants match draw_tile() placement") {
+	Ref<Image> image;
+	image.instantiate();
+	image->create(32, 8, false, Image::FORMAT_RGBA8);
+	Ref<ImageTexture> texture;
+	texture.instantiate();
+	texture->create_from_image(image);
+
+	// Non-square tiles, so transposing them changes their placement.
+	Ref<TileSetAtlasSource> atlas_source;
+	atlas_source.instantiate();
+	atlas_source->set_use_texture_padding(false);
+	atlas_source->set_texture(texture);
+	atlas_source->set_texture_region_size(Vector2i(16, 8));
+	atlas_source->create_tile(Vector2i(1, 0));
+
+	// Alternative tiles with every flip and transpose combination checked below.
+	const int alternatives_count = 5;
+	const bool flips_h[alternatives_count] = { false, true, false, true, false };
+	const bool flips_v[alternatives_count] = { false, false, true, true, false };
+	const bool transposes[alternatives_count] = { false, false, true, true, true };
+	for (int i = 1; i < alternatives_count; i++) {
+		atlas_source->create_alternative_tile(Vector2i(1, 0), i);
+	}
+	for (int i = 0; i < alternatives_count; i++) {
+		TileData *tile_data = atlas_source->get_tile_data(Vector2i(1, 0), i);
+		tile_data->set_flip_h(flips_h[i]);
+		tile_data->set_flip_v(flips_v[i]);
+		tile_data->set_transpose(transposes[i]);
+	}
+
+	Ref<TileSet> tile_set;
+	tile_set.instantiate();
+	int source_id = tile_set->add_source(atlas_source);
+
+	// One tile per quadrant, so there are enough quadrants to bake them on worker threads.
+	TileMap *tile_map = memnew(TileMap);
+	tile_map->set_tileset(tile_set);
+	tile_map->set_quadrant_size(1);
+	for (int i = 0; i < alternatives_count; i++) {
+		tile_map->set_cell(0, Vector2i(i, i % 2), source_id, Vector2i(1, 0), i);
+	}
+
+	tile_map->bake_quadrants_rendering(0);
+
+	const Size2 texture_size = texture->get_size();
+	const Rect2 source_rect = atlas_source->get_runtime_tile_texture_region(Vector2i(1, 0), 0);
+	const Vector2 corners[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+	int baked_count = 0;
+	for (KeyValue<Vector2i, TileMapQuadrant> &E : *tile_map->get_quadrant_map(0)) {
+		const TileMapQuadrant &q = E.value;
+		REQUIRE(q.cells.size() == 1);
+		const Vector2i coords = q.cells.front()->get();
+		const int alternative = tile_map->get_cell_alternative_tile(0, coords);
+
+		REQUIRE(q.baked_canvas_items.size() == 1);
+		const TileMapQuadrant::BakedCanvasItem &item = q.baked_canvas_items[0];
+		REQUIRE(item.segments.size() == 1);
+		const TileMapQuadrant::BakedSegment &segment = item.segments[0];
+		CHECK_FALSE(segment.draw_tile);
+		REQUIRE(segment.points.size() == 4);
+		REQUIRE(segment.uvs.size() == 4);
+
+		// The rect draw_tile() would draw in the same canvas item, as the rendering server resolves it:
+		// flips only mirror the texture, and transposing swaps the rect size.
+		const Vector2 tile_position = Vector2i(tile_map->map_to_world(coords) - item.position);
+		Rect2 dest_rect;
+		dest_rect.size = source_rect.size + Size2(0.00001, 0.00001); // TileMap::FP_ADJUST.
+		if (transposes[alternative]) {
+			dest_rect.position = tile_position - Vector2(dest_rect.size.y, dest_rect.size.x) / 2;
+			SWAP(dest_rect.size.x, dest_rect.size.y);
+		} else {
+			dest_rect.position = tile_position - dest_rect.size / 2;
+		}
+
+		for (int i = 0; i < 4; i++) {
+			const Vector2 corner = corners[i];
+			const Vector2 vertex_corner = Vector2(flips_h[alternative] ? 1.0 - corner.x : corner.x, flips_v[alternative] ? 1.0 - corner.y : corner.y);
+			const Vector2 uv_corner = transposes[alternative] ? Vector2(corner.y, corner.x) : corner;
+			CHECK_MESSAGE(segment.points[i].is_equal_approx(dest_rect.position + dest_rect.size * vertex_corner), vformat("Vertex %d of alternative tile %d should match draw_tile().", i, alternative));
+			CHECK_MESSAGE(segment.uvs[i].is_equal_approx((source_rect.position + source_rect.size * uv_corner) / texture_size), vformat("UV %d of alternative tile %d should match draw_tile().", i, alternative));
+		}
+		baked_count++;
+	}
+	CHECK(baked_count == alternatives_count);
+
+	memdelete(tile_map);
+}
+
+} // namespace TestTileMap
+
+#endif // TEST_TILE_MAP_H
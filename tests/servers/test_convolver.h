@@ -0,0 +1,137 @@
+/*************************************************************************/
+/*  test_convolver.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_CONVOLVER_H
+#define TEST_CONVOLVER_H
+
+#include "servers/audio/effects/convolver.h"
+
+#include "tests/test_macros.h"
+
+namespace TestConvolver {
+
+// Reference output of the convolver, computed directly in the time domain and delayed by one block.
+static Vector<AudioFrame> direct_convolution(const Vector<AudioFrame> &p_impulse, const Vector<AudioFrame> &p_input, int p_delay) {
+	Vector<AudioFrame> result;
+	result.resize(p_input.size());
+	for (int n = 0; n < p_input.size(); n++) {
+		AudioFrame sum = AudioFrame(0, 0);
+		int out = n - p_delay;
+		for (int m = 0; m < p_impulse.size() && m <= out; m++) {
+			sum.l += p_impulse[m].l * p_input[out - m].l;
+			sum.r += p_impulse[m].r * p_input[out - m].r;
+		}
+		result.write[n] = sum;
+	}
+	return result;
+}
+
+static Vector<AudioFrame> make_signal(int p_size, float p_seed) {
+	Vector<AudioFrame> signal;
+	signal.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		signal.write[i] = AudioFrame(Math::sin(i * 0.37 * p_seed) * Math::cos(i * 0.011), Math::cos(i * 0.23 * p_seed) * 0.5);
+	}
+	return signal;
+}
+
+static void check_against_reference(int p_block_size, int p_impulse_size, bool p_shared_kernel) {
+	Vector<AudioFrame> impulse = make_signal(p_impulse_size, 1.3);
+	Vector<AudioFrame> input = make_signal(4000, 0.7);
+	Vector<AudioFrame> expected = direct_convolution(impulse, input, p_block_size);
+
+	Convolver::Kernel kernel;
+	Convolver convolver;
+	if (p_shared_kernel) {
+		kernel.build(impulse, p_block_size);
+		convolver.set_kernel(&kernel);
+	} else {
+		convolver.set_impulse_response(impulse, p_block_size);
+	}
+	CHECK(convolver.get_partition_count() == MAX(1, (p_impulse_size + p_block_size - 1) / p_block_size));
+
+	// Feed the input in uneven chunks, to cover blocks straddling process calls.
+	Vector<AudioFrame> output;
+	output.resize(input.size());
+	int pos = 0;
+	int chunk = 37;
+	while (pos < input.size()) {
+		int count = MIN(chunk, input.size() - pos);
+		convolver.process(&input[pos], &output.write[pos], count);
+		pos += count;
+		chunk = chunk * 7 % 101 + 1;
+	}
+
+	float max_error = 0;
+	for (int i = 0; i < input.size(); i++) {
+		max_error = MAX(max_error, MAX(Math::abs(output[i].l - expected[i].l), Math::abs(output[i].r - expected[i].r)));
+	}
+	CHECK_MESSAGE(max_error < 1e-3, vformat("Convolution error %f exceeds tolerance.", max_error));
+}
+
+TEST_CASE("[Convolver] Matches direct convolution") {
+	check_against_reference(64, 1, false);
+	check_against_reference(64, 64, false);
+	check_against_reference(64, 300, false);
+	check_against_reference(128, 2500, false);
+}
+
+TEST_CASE("[Convolver] Matches direct convolution with a shared kernel") {
+	check_against_reference(64, 300, true);
+	check_against_reference(256, 3000, true);
+}
+
+TEST_CASE("[Convolver] Clear resets the delay line") {
+	Vector<AudioFrame> impulse = make_signal(200, 1.1);
+	Vector<AudioFrame> input = make_signal(512, 0.9);
+
+	Convolver convolver;
+	convolver.set_impulse_response(impulse, 64);
+
+	Vector<AudioFrame> output;
+	output.resize(input.size());
+	convolver.process(input.ptr(), output.ptrw(), input.size());
+	convolver.clear();
+
+	Vector<AudioFrame> silence;
+	silence.resize(input.size());
+	for (int i = 0; i < silence.size(); i++) {
+		silence.write[i] = AudioFrame(0, 0);
+	}
+	convolver.process(silence.ptr(), output.ptrw(), silence.size());
+	for (int i = 0; i < output.size(); i++) {
+		CHECK(output[i].l == 0);
+		CHECK(output[i].r == 0);
+	}
+}
+
+} // namespace TestConvolver
+
+#endif // TEST_CONVOLVER_H
@@ -120,6 +120,42 @@ namespace RVO {
 		}
 	}
 
+	void KdTree::refitAgentTree()
+	{
+		if (!agents_.empty()) {
+			refitAgentTreeRecursive(0);
+		}
+	}
+
+	void KdTree::refitAgentTreeRecursive(size_t node)
+	{
+		AgentTreeNode &treeNode = agentTree_[node];
+
+		if (treeNode.end - treeNode.begin > RVO3D_MAX_LEAF_SIZE) {
+			refitAgentTreeRecursive(treeNode.left);
+			refitAgentTreeRecursive(treeNode.right);
+
+			const AgentTreeNode &leftNode = agentTree_[treeNode.left];
+			const AgentTreeNode &rightNode = agentTree_[treeNode.right];
+
+			for (size_t i = 0; i < 3; ++i) {
+				treeNode.minCoord[i] = std::min(leftNode.minCoord[i], rightNode.minCoord[i]);
+				treeNode.maxCoord[i] = std::max(leftNode.maxCoord[i], rightNode.maxCoord[i]);
+			}
+		}
+		else {
+			treeNode.minCoord = agents_[treeNode.begin]->position_;
+			treeNode.maxCoord = agents_[treeNode.begin]->position_;
+
+			for (size_t i = treeNode.begin + 1; i < treeNode.end; ++i) {
+				for (size_t j = 0; j < 3; ++j) {
+					treeNode.minCoord[j] = std::min(treeNode.minCoord[j], agents_[i]->position_[j]);
+					treeNode.maxCoord[j] = std::max(treeNode.maxCoord[j], agents_[i]->position_[j]);
+				}
+			}
+		}
+	}
+
 	void KdTree::computeAgentNeighbors(Agent *agent, float rangeSq) const
 	{
 		queryAgentTreeRecursive(agent, rangeSq, 0);
@@ -44,6 +44,7 @@
 // Note: Slightly modified to work better with Godot.
 // - Removed `sim_`.
 // - KdTree things are public
+// - Added `refitAgentTree` to update the node bounds without rebuilding
 namespace RVO {
 	class Agent;
 	class RVOSimulator;
@@ -102,6 +103,14 @@ namespace RVO {
 
 		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
 
+		/**
+		 * \brief   Recomputes the bounds of the agent <i>k</i>d-tree nodes from
+		 *          the current agent positions, keeping the tree topology.
+		 */
+		void refitAgentTree();
+
+		void refitAgentTreeRecursive(size_t node);
+
 		/**
 		 * \brief   Computes the agent neighbors of the specified agent.
 		 * \param   agent    A pointer to the agent for which agent neighbors are to be computed.